@@ -0,0 +1,36 @@
+function [] = argscan_bench()
+
+% Benchmark of function calls taking a large matrix argument,
+% run with the JIT enabled to time call dispatch
+
+% Number of elements in the matrix argument
+NUM_ELEMS = 1000000;
+
+% Number of calls to perform
+NUM_CALLS = 2000;
+
+% Create a large integer-valued matrix
+m = ones(1, NUM_ELEMS);
+
+% Time the calls to the tiny function
+tic;
+s = 0;
+for i = 1:NUM_CALLS
+    s = s + argscan_first(m);
+end
+totalTime = toc;
+
+% Print the total call time
+fprintf(1, 'Total time: %fs\n', totalTime);
+
+% Display the result
+disp(s);
+
+end
+
+function [v] = argscan_first(m)
+
+% Return the first element of the matrix
+v = m(1);
+
+end
@@ -0,0 +1,30 @@
+function [] = deadvars_bench()
+
+% Benchmark creating many large intermediate matrices, run with the
+% JIT disabled and -release_dead_vars / -free_dead_buffers set to
+% true or false, then compare the heap statistics
+
+% Matrix size and number of iterations
+N = 600;
+NUM_ITRS = 40;
+
+% Time a loop where each temporary dies before the next is created
+tic;
+s = 0;
+for i = 1:NUM_ITRS
+    a = ones(N, N) * i;
+    b = a .* a;
+    c = b - a;
+    d = c ./ (b + 1);
+    s = s + sum(sum(d));
+end
+loopTime = toc;
+
+% Print the loop time
+fprintf(1, 'Loop time: %fs\n', loopTime);
+
+% Display the accumulated value and the collector statistics
+disp(s);
+disp(mcvm_gc_stats());
+
+end
@@ -0,0 +1,33 @@
+function [] = deadvars_test()
+
+% Tests that variables read after their last use in the function
+% body are not released early when release_dead_vars is enabled
+%
+% Expected output: 3, 5 and 7
+
+% Variable only read afterwards by a nested function
+x = 3;
+disp(readX());
+
+% Variable only read afterwards through an escaped closure
+y = 5;
+h = @() y;
+disp(h());
+
+% Closure escaping the function creating it
+g = makeHandle();
+disp(g());
+
+	function r = readX()
+		r = x;
+	end
+
+end
+
+function h = makeHandle()
+
+% Variable captured by the returned closure
+v = 7;
+h = @() v;
+
+end
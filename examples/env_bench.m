@@ -0,0 +1,37 @@
+function [] = env_bench()
+
+% Benchmark of variable lookups in the interpreter, run with
+% the JIT disabled to time environment accesses
+
+% Fibonacci number to compute, exercises call environments
+FIB_NUM = 22;
+
+% Number of iterations of the local variable loop
+NUM_ITRS = 200000;
+
+% Time the recursive fibonacci computation
+tic;
+val = fibonacci(FIB_NUM);
+fibTime = toc;
+
+% Time a loop reading and writing several local variables
+tic;
+a = 0;
+b = 1;
+c = 0;
+for i = 1:NUM_ITRS
+    c = a + b;
+    a = b - c;
+    b = c + i;
+end
+loopTime = toc;
+
+% Print the computation times
+fprintf(1, 'Fibonacci time: %fs\n', fibTime);
+fprintf(1, 'Loop time: %fs\n', loopTime);
+
+% Display the results
+disp(val);
+disp(b);
+
+end
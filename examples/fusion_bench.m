@@ -0,0 +1,32 @@
+function [] = fusion_bench()
+
+% Benchmark of chained element-wise array operations, run with
+% and without -fuse_array_ops to compare fused evaluation
+
+% Number of elements in each array
+NUM_ELEMS = 1000000;
+
+% Number of times to evaluate the expression
+NUM_ITRS = 100;
+
+% Create the operand arrays
+a = rand(1, NUM_ELEMS);
+b = rand(1, NUM_ELEMS);
+c = rand(1, NUM_ELEMS);
+d = rand(1, NUM_ELEMS);
+e = rand(1, NUM_ELEMS);
+
+% Time the evaluation of the element-wise expression
+tic;
+for i = 1:NUM_ITRS
+    r = a .* b + c .* d - e;
+end
+totalTime = toc;
+
+% Print the total evaluation time
+fprintf(1, 'Total time: %fs\n', totalTime);
+
+% Display a checksum of the result
+disp(sum(r));
+
+end
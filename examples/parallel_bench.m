@@ -0,0 +1,40 @@
+function [] = parallel_bench()
+
+% Benchmark of element-wise operations and reductions over large
+% arrays, run with different -num_threads values to compare scaling
+
+% Size of the operand matrices
+NUM_ROWS = 2000;
+NUM_COLS = 2000;
+
+% Number of times to perform each operation
+NUM_ITRS = 50;
+
+% Create the operand matrices
+a = rand(NUM_ROWS, NUM_COLS);
+b = rand(NUM_ROWS, NUM_COLS);
+
+% Time the element-wise operations
+tic;
+for i = 1:NUM_ITRS
+    r = a + b;
+    r = r .* 2;
+end
+arrayTime = toc;
+
+% Time the column reductions
+tic;
+for i = 1:NUM_ITRS
+    s = sum(a);
+end
+reduceTime = toc;
+
+% Print the timings
+fprintf(1, 'Element-wise time: %fs\n', arrayTime);
+fprintf(1, 'Reduction time: %fs\n', reduceTime);
+
+% Display checksums of the results
+disp(sum(sum(r)));
+disp(sum(s));
+
+end
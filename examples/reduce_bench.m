@@ -0,0 +1,40 @@
+function [] = reduce_bench()
+
+% Benchmark of column-wise and row-wise reductions over a large
+% matrix, row-wise reductions stride through column-major storage
+
+% Size of the operand matrix
+NUM_ROWS = 2000;
+NUM_COLS = 2000;
+
+% Number of times to perform each reduction
+NUM_ITRS = 50;
+
+% Create the operand matrix
+a = rand(NUM_ROWS, NUM_COLS);
+
+% Time the column-wise reductions
+tic;
+for i = 1:NUM_ITRS
+    s1 = sum(a, 1);
+    m1 = max(a);
+end
+colTime = toc;
+
+% Time the row-wise reductions
+tic;
+for i = 1:NUM_ITRS
+    s2 = sum(a, 2);
+    m2 = mean(a, 2);
+end
+rowTime = toc;
+
+% Print the timings
+fprintf(1, 'Column-wise time: %fs\n', colTime);
+fprintf(1, 'Row-wise time: %fs\n', rowTime);
+
+% Display checksums of the results
+disp(sum(s1) + sum(m1));
+disp(sum(s2) + sum(m2));
+
+end
@@ -0,0 +1,29 @@
+function [] = scalar_bench()
+
+% Benchmark of scalar arithmetic in interpreted loops, run with
+% the JIT disabled and -unboxed_scalars true or false
+
+% Number of loop iterations
+NUM_ITRS = 500000;
+
+% Time a loop of nested scalar expressions and conditions
+tic;
+s = 0;
+x = 0.5;
+for i = 1:NUM_ITRS
+    x = (x * 3.9) * (1 - x) + 1e-9;
+    if x > 0.5 && i < NUM_ITRS
+        s = s + 2 * x - 1;
+    else
+        s = s - x / 2;
+    end
+end
+loopTime = toc;
+
+% Print the loop time
+fprintf(1, 'Loop time: %fs\n', loopTime);
+
+% Display the accumulated value
+disp(s);
+
+end
@@ -0,0 +1,488 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cassert>
+#include <algorithm>
+#include "arrayfusion.h"
+#include "interpreter.h"
+#include "binaryopexpr.h"
+#include "unaryopexpr.h"
+#include "matrixobjs.h"
+#include "matrixops.h"
+#include "runtimebase.h"
+
+// Config variable to enable/disable expression fusion
+ConfigVar FusedArrayOp::s_fuseArrayOpsVar("fuse_array_ops", ConfigVar::BOOL, "true");
+
+// Static map of fused operations
+FusedArrayOp::FusedOpMap FusedArrayOp::s_fusedOpMap;
+
+// Number of elements evaluated per block
+const size_t FusedArrayOp::BLOCK_SIZE;
+
+/***************************************************************
+* Function: FusedArrayOp::initialize()
+* Purpose : Initialize the expression fusion stage
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void FusedArrayOp::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_fuseArrayOpsVar);
+}
+
+/***************************************************************
+* Function: FusedArrayOp::isFusableOp()
+* Purpose : Test if an expression is a fusable element-wise op
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool FusedArrayOp::isFusableOp(const Expression* pExpr)
+{
+	// If this is a binary expression
+	if (pExpr->getExprType() == Expression::BINARY_OP)
+	{
+		// Get the operator type
+		BinaryOpExpr::Operator op = ((const BinaryOpExpr*)pExpr)->getOperator();
+		
+		// Element-wise arithmetic operators are fusable
+		return (op == BinaryOpExpr::PLUS || op == BinaryOpExpr::MINUS ||
+				op == BinaryOpExpr::ARRAY_MULT || op == BinaryOpExpr::ARRAY_DIV);
+	}
+	
+	// If this is a unary expression, arithmetic negation is fusable
+	if (pExpr->getExprType() == Expression::UNARY_OP)
+		return ((const UnaryOpExpr*)pExpr)->getOperator() == UnaryOpExpr::MINUS;
+	
+	// Other expressions are not fusable
+	return false;
+}
+
+/***************************************************************
+* Function: FusedArrayOp::getFusedOp()
+* Purpose : Get the fused operation for an expression tree
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+FusedArrayOp* FusedArrayOp::getFusedOp(const Expression* pExpr)
+{
+	// Attempt to find a cached fused operation for this expression
+	FusedOpMap::iterator fusedItr = s_fusedOpMap.find(pExpr);
+	
+	// If there is an entry for this expression, return it
+	if (fusedItr != s_fusedOpMap.end())
+		return fusedItr->second;
+	
+	// Declare a pointer for the fused operation
+	FusedArrayOp* pFusedOp = NULL;
+	
+	// If the expression is a fusable operation
+	if (isFusableOp(pExpr))
+	{
+		// Create the fused program for the expression tree
+		pFusedOp = new FusedArrayOp(pExpr);
+		
+		// A single operation gains nothing from fusion
+		if (pFusedOp->getNumOps() < 2)
+			pFusedOp = NULL;
+	}
+	
+	// Cache the fused operation, a null entry marks an unfusable tree
+	s_fusedOpMap[pExpr] = pFusedOp;
+	
+	// Return the fused operation
+	return pFusedOp;
+}
+
+/***************************************************************
+* Function: FusedArrayOp::FusedArrayOp()
+* Purpose : Build the fused program for an expression tree
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+FusedArrayOp::FusedArrayOp(const Expression* pExpr)
+{
+	// Append the instructions for the expression tree
+	addExpr(pExpr);
+	
+	// Compute the maximum operand stack depth
+	size_t depth = 0;
+	m_maxDepth = 0;
+	for (InstrVector::iterator itr = m_program.begin(); itr != m_program.end(); ++itr)
+	{
+		// Leaves push an operand, binary operations pop one
+		if (itr->op == OP_LEAF)
+			++depth;
+		else if (itr->op != OP_NEG)
+			--depth;
+		
+		// Update the maximum depth
+		m_maxDepth = std::max(m_maxDepth, depth);
+	}
+}
+
+/***************************************************************
+* Function: FusedArrayOp::addExpr()
+* Purpose : Append the instructions of an expression tree
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void FusedArrayOp::addExpr(const Expression* pExpr)
+{
+	// Declare an instruction object
+	Instr instr;
+	instr.leafIndex = 0;
+	
+	// If the expression is not a fusable operation
+	if (!isFusableOp(pExpr))
+	{
+		// Add the expression as a leaf operand
+		instr.op = OP_LEAF;
+		instr.leafIndex = m_leaves.size();
+		m_leaves.push_back((Expression*)pExpr);
+		m_program.push_back(instr);
+		return;
+	}
+	
+	// If this is a unary negation
+	if (pExpr->getExprType() == Expression::UNARY_OP)
+	{
+		// Add the operand, followed by the negation
+		addExpr(((const UnaryOpExpr*)pExpr)->getOperand());
+		instr.op = OP_NEG;
+		m_program.push_back(instr);
+		return;
+	}
+	
+	// Get a typed pointer to the binary expression
+	const BinaryOpExpr* pBinaryExpr = (const BinaryOpExpr*)pExpr;
+	
+	// Add the left and right operands, in evaluation order
+	addExpr(pBinaryExpr->getLeftExpr());
+	addExpr(pBinaryExpr->getRightExpr());
+	
+	// Switch on the operator type
+	switch (pBinaryExpr->getOperator())
+	{
+		case BinaryOpExpr::PLUS:		instr.op = OP_PLUS; break;
+		case BinaryOpExpr::MINUS:		instr.op = OP_MINUS; break;
+		case BinaryOpExpr::ARRAY_MULT:	instr.op = OP_MULT; break;
+		case BinaryOpExpr::ARRAY_DIV:	instr.op = OP_DIV; break;
+		default: assert (false);
+	}
+	
+	// Add the operation
+	m_program.push_back(instr);
+}
+
+/***************************************************************
+* Function: FusedArrayOp::evaluate()
+* Purpose : Evaluate the fused operation in an environment
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* FusedArrayOp::evaluate(Environment* pEnv) const
+{
+	// Create an array object to store the leaf values
+	ArrayObj* pLeafVals = new ArrayObj(m_leaves.size());
+	
+	// Evaluate the leaf expressions in order
+	for (Expression::ExprVector::const_iterator itr = m_leaves.begin(); itr != m_leaves.end(); ++itr)
+		ArrayObj::addObject(pLeafVals, Interpreter::evalExpression(*itr, pEnv));
+	
+	// Evaluate the fused operation on the leaf values
+	return evalLeaves(this, pLeafVals);
+}
+
+/***************************************************************
+* Function: FusedArrayOp::evalLeaves()
+* Purpose : Evaluate the fused operation on leaf values
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* FusedArrayOp::evalLeaves(const FusedArrayOp* pFusedOp, const ArrayObj* pLeafVals)
+{
+	// Get the number of leaf values
+	size_t numLeaves = pLeafVals->getSize();
+	
+	// Declare a pointer to the first non-scalar leaf
+	const MatrixF64Obj* pShapeMatrix = NULL;
+	
+	// For each leaf value
+	for (size_t i = 0; i < numLeaves; ++i)
+	{
+		// Get the leaf value
+		const DataObject* pValue = pLeafVals->getObject(i);
+		
+		// If this is not a 64-bit float matrix, use the regular operations
+		if (pValue->getType() != DataObject::MATRIX_F64)
+			return pFusedOp->evalUnfused(pLeafVals);
+		
+		// Get a typed pointer to the matrix
+		const MatrixF64Obj* pMatrix = (const MatrixF64Obj*)pValue;
+		
+		// Scalars are broadcast to every element
+		if (pMatrix->isScalar())
+			continue;
+		
+		// If the matrix does not match the shape of the other
+		// non-scalar leaves, use the regular operations
+		if (pShapeMatrix == NULL)
+			pShapeMatrix = pMatrix;
+		else if (pMatrix->getSize() != pShapeMatrix->getSize())
+			return pFusedOp->evalUnfused(pLeafVals);
+	}
+	
+	// Create the output matrix, a scalar if all the leaves are scalars
+	MatrixF64Obj* pOutput = (pShapeMatrix != NULL)? new MatrixF64Obj(pShapeMatrix->getSize()):MatrixF64Obj::makeScalar(0);
+	float64* pOutData = pOutput->getElements();
+	
+	// Get the number of output elements
+	size_t numElems = pOutput->getNumElems();
+	
+	// If the output is empty, return it directly
+	if (numElems == 0)
+		return pOutput;
+	
+	// Operand stack entry structure
+	struct Operand
+	{
+		// Pointer to the operand data
+		const float64* pData;
+		
+		// Indicates if the operand is a scalar
+		bool isScalar;
+	};
+	
+	// Get a reference to the fused program
+	const InstrVector& program = pFusedOp->m_program;
+	
+	// Allocate the operand stack and one block buffer per stack level
+	std::vector<Operand> stack(pFusedOp->m_maxDepth);
+	std::vector<float64> buffers(pFusedOp->m_maxDepth * BLOCK_SIZE);
+	
+	// For each block of elements
+	// NOTE: each element of the output is computed in a single pass, the
+	//       intermediate results only live in cache-sized block buffers
+	for (size_t base = 0; base < numElems; base += BLOCK_SIZE)
+	{
+		// Compute the number of elements in this block
+		size_t blockSize = std::min(BLOCK_SIZE, numElems - base);
+		
+		// Initialize the operand stack pointer
+		size_t sp = 0;
+		
+		// For each instruction
+		for (size_t i = 0; i < program.size(); ++i)
+		{
+			// Get a reference to the instruction
+			const Instr& instr = program[i];
+			
+			// If this is a leaf operand
+			if (instr.op == OP_LEAF)
+			{
+				// Get the leaf matrix
+				const MatrixF64Obj* pMatrix = (const MatrixF64Obj*)pLeafVals->getObject(instr.leafIndex);
+				
+				// Push the leaf data for this block
+				stack[sp].isScalar = pMatrix->isScalar();
+				stack[sp].pData = pMatrix->getElements() + (stack[sp].isScalar? 0:base);
+				++sp;
+				continue;
+			}
+			
+			// Get the number of operands of the operation
+			size_t numOperands = (instr.op == OP_NEG)? 1:2;
+			
+			// Get references to the operands
+			Operand& left = stack[sp - numOperands];
+			const Operand& right = stack[sp - 1];
+			
+			// Determine if the result is a scalar
+			bool scalarOut = left.isScalar && right.isScalar;
+			
+			// The last instruction writes directly into the output matrix,
+			// other instructions write into the buffer for their stack level
+			float64* pDst = (i + 1 == program.size() && !scalarOut)? 
+				(pOutData + base):&buffers[(sp - numOperands) * BLOCK_SIZE];
+			
+			// Get the number of elements to compute
+			size_t count = scalarOut? 1:blockSize;
+			
+			// Get the operand strides
+			size_t lStride = left.isScalar? 0:1;
+			size_t rStride = right.isScalar? 0:1;
+			
+			// Get pointers to the operand data
+			const float64* pL = left.pData;
+			const float64* pR = right.pData;
+			
+			// Switch on the operation type
+			switch (instr.op)
+			{
+				case OP_PLUS:	for (size_t j = 0; j < count; ++j) pDst[j] = pL[j * lStride] + pR[j * rStride]; break;
+				case OP_MINUS:	for (size_t j = 0; j < count; ++j) pDst[j] = pL[j * lStride] - pR[j * rStride]; break;
+				case OP_MULT:	for (size_t j = 0; j < count; ++j) pDst[j] = pL[j * lStride] * pR[j * rStride]; break;
+				case OP_DIV:	for (size_t j = 0; j < count; ++j) pDst[j] = pL[j * lStride] / pR[j * rStride]; break;
+				case OP_NEG:	for (size_t j = 0; j < count; ++j) pDst[j] = -pL[j * lStride]; break;
+				default: assert (false);
+			}
+			
+			// Replace the operands by the result
+			left.pData = pDst;
+			left.isScalar = scalarOut;
+			sp -= numOperands - 1;
+		}
+		
+		// If the result is a scalar, store it
+		// NOTE: this only happens when all the leaves are scalars
+		if (stack[0].isScalar)
+			pOutData[0] = stack[0].pData[0];
+	}
+	
+	// Return the output matrix
+	return pOutput;
+}
+
+/***************************************************************
+* Function: FusedArrayOp::evalScalar()
+* Purpose : Evaluate the fused operation on scalar leaf values
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+float64 FusedArrayOp::evalScalar(const float64* pLeafVals) const
+{
+	// Use a local operand stack, unless the program is unusually deep
+	float64 localStack[16];
+	std::vector<float64> heapStack;
+	float64* pStack = localStack;
+	if (m_maxDepth > 16)
+	{
+		heapStack.resize(m_maxDepth);
+		pStack = &heapStack[0];
+	}
+	
+	// Initialize the operand stack pointer
+	size_t sp = 0;
+	
+	// For each instruction
+	for (InstrVector::const_iterator itr = m_program.begin(); itr != m_program.end(); ++itr)
+	{
+		// Switch on the operation type
+		switch (itr->op)
+		{
+			case OP_LEAF:	pStack[sp++] = pLeafVals[itr->leafIndex]; break;
+			case OP_PLUS:	--sp; pStack[sp - 1] = pStack[sp - 1] + pStack[sp]; break;
+			case OP_MINUS:	--sp; pStack[sp - 1] = pStack[sp - 1] - pStack[sp]; break;
+			case OP_MULT:	--sp; pStack[sp - 1] = pStack[sp - 1] * pStack[sp]; break;
+			case OP_DIV:	--sp; pStack[sp - 1] = pStack[sp - 1] / pStack[sp]; break;
+			case OP_NEG:	pStack[sp - 1] = -pStack[sp - 1]; break;
+			default: assert (false);
+		}
+	}
+	
+	// Return the result value
+	assert (sp == 1);
+	return pStack[0];
+}
+
+/***************************************************************
+* Function: FusedArrayOp::evalUnfused()
+* Purpose : Evaluate the program with the regular array ops
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* FusedArrayOp::evalUnfused(const ArrayObj* pLeafVals) const
+{
+	// Create an operand stack for the intermediate values
+	std::vector<DataObject*, gc_allocator<DataObject*> > stack;
+	
+	// For each instruction
+	for (InstrVector::const_iterator itr = m_program.begin(); itr != m_program.end(); ++itr)
+	{
+		// Switch on the operation type
+		switch (itr->op)
+		{
+			// Leaf operand
+			case OP_LEAF:
+			{
+				// Push the leaf value
+				stack.push_back(pLeafVals->getObject(itr->leafIndex));
+			}
+			break;
+			
+			// Arithmetic negation
+			case OP_NEG:
+			{
+				// Get the operand value
+				DataObject* pArgVal = stack.back();
+				
+				// If the value is a 128-bit complex matrix, multiply it by -1
+				if (pArgVal->getType() == DataObject::MATRIX_C128)
+				{
+					stack.back() = MatrixC128Obj::scalarMult((MatrixC128Obj*)pArgVal, -1);
+					break;
+				}
+				
+				// Convert the argument to a 64-bit matrix, if necessary
+				if (pArgVal->getType() != DataObject::MATRIX_F64)
+					pArgVal = pArgVal->convert(DataObject::MATRIX_F64);
+				
+				// Multiply the matrix by -1
+				stack.back() = MatrixF64Obj::scalarMult((MatrixF64Obj*)pArgVal, -1);
+			}
+			break;
+			
+			// Binary operations
+			default:
+			{
+				// Pop the right operand
+				DataObject* pRightVal = stack.back();
+				stack.pop_back();
+				
+				// Get the left operand
+				DataObject* pLeftVal = stack.back();
+				
+				// Switch on the operation type
+				switch (itr->op)
+				{
+					case OP_PLUS:	stack.back() = arrayArithOp<AddOp>(pLeftVal, pRightVal); break;
+					case OP_MINUS:	stack.back() = arrayArithOp<SubOp>(pLeftVal, pRightVal); break;
+					case OP_MULT:	stack.back() = arrayArithOp<MultOp>(pLeftVal, pRightVal); break;
+					case OP_DIV:	stack.back() = arrayArithOp<DivOp>(pLeftVal, pRightVal); break;
+					default: assert (false);
+				}
+			}
+		}
+	}
+	
+	// Return the result value
+	assert (stack.size() == 1);
+	return stack.back();
+}
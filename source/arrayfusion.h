@@ -0,0 +1,125 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef ARRAYFUSION_H_
+#define ARRAYFUSION_H_
+
+// Header files
+#include <vector>
+#include <ext/hash_map>
+#include "platform.h"
+#include "configmanager.h"
+#include "expressions.h"
+#include "environment.h"
+#include "arrayobj.h"
+#include "utility.h"
+
+/***************************************************************
+* Class   : FusedArrayOp
+* Purpose : Fused evaluation of element-wise expression trees
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class FusedArrayOp : public gc
+{
+public:
+	
+	// Fused operation types
+	enum OpType
+	{
+		OP_LEAF,
+		OP_PLUS,
+		OP_MINUS,
+		OP_MULT,
+		OP_DIV,
+		OP_NEG
+	};
+	
+	// Fused program instruction structure
+	struct Instr
+	{
+		// Operation type
+		OpType op;
+		
+		// Leaf operand index, for leaf instructions
+		size_t leafIndex;
+	};
+	
+	// Instruction vector type definition
+	typedef std::vector<Instr> InstrVector;
+	
+	// Method to initialize the fusion stage
+	static void initialize();
+	
+	// Method to test if an expression is a fusable element-wise operation
+	static bool isFusableOp(const Expression* pExpr);
+	
+	// Method to get the fused operation for an expression tree
+	static FusedArrayOp* getFusedOp(const Expression* pExpr);
+	
+	// Method to evaluate the fused operation in an environment
+	DataObject* evaluate(Environment* pEnv) const;
+	
+	// Static method to evaluate the fused operation on leaf values
+	static DataObject* evalLeaves(const FusedArrayOp* pFusedOp, const ArrayObj* pLeafVals);
+	
+	// Method to evaluate the fused operation on scalar leaf values
+	float64 evalScalar(const float64* pLeafVals) const;
+	
+	// Accessor to get the leaf operand expressions
+	const Expression::ExprVector& getLeaves() const { return m_leaves; }
+	
+	// Accessor to get the number of fused operations
+	size_t getNumOps() const { return m_program.size() - m_leaves.size(); }
+	
+	// Config variable to enable/disable expression fusion
+	static ConfigVar s_fuseArrayOpsVar;
+	
+private:
+	
+	// Constructor
+	FusedArrayOp(const Expression* pExpr);
+	
+	// Method to append the instructions of an expression tree
+	void addExpr(const Expression* pExpr);
+	
+	// Method to evaluate the program with the regular array operations
+	DataObject* evalUnfused(const ArrayObj* pLeafVals) const;
+	
+	// Number of elements processed per block
+	static const size_t BLOCK_SIZE = 256;
+	
+	// Postfix instruction program
+	InstrVector m_program;
+	
+	// Leaf operand expressions, in evaluation order
+	Expression::ExprVector m_leaves;
+	
+	// Maximum operand stack depth of the program
+	size_t m_maxDepth;
+	
+	// Fused operation map type definition
+	typedef __gnu_cxx::hash_map<const Expression*, FusedArrayOp*, IntHashFunc<const Expression*>, __gnu_cxx::equal_to<const Expression*>, gc_allocator<FusedArrayOp*> > FusedOpMap;
+	
+	// Map of fused operations, per expression tree root
+	static FusedOpMap s_fusedOpMap;
+};
+
+#endif // #ifndef ARRAYFUSION_H_
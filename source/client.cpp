@@ -22,6 +22,8 @@
 #include <sstream>
 #include <iostream>
 #include <ctime>
+#include <climits>
+#include <sys/stat.h>
 #include "client.h"
 #include "filesystem.h"
 #include "xml.h"
@@ -205,6 +207,44 @@ void Client::openSocketStream(const char *svrName, const int svrPortNo)
 	}
 }
 
+/*******************************************************************
+* Function: Client::getFrontendVersion()
+* Purpose : Identifies the installed frontend version
+* Initial : McVM team on October 16, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+std::string Client::getFrontendVersion()
+{
+	// identify the frontend by its command line
+	std::string version = FRONTEND_ENTRY_POINT + FRONTEND_ARGUMENTS;
+
+	// look for the entry point in the search path
+	const char* pathVar = getenv("PATH");
+	std::istringstream pathStream(pathVar? pathVar:"");
+	std::string dir;
+	while (std::getline(pathStream, dir, ':'))
+	{
+		// resolve links, so that installing another frontend changes the path
+		char realPath[PATH_MAX];
+		if (realpath((dir + "/" + FRONTEND_ENTRY_POINT).c_str(), realPath) == NULL)
+			continue;
+
+		// get the entry point file status information
+		struct stat fileStat;
+		if (stat(realPath, &fileStat) != 0)
+			continue;
+
+		// add the installed entry point path, modification time and size
+		std::ostringstream fileInfo;
+		fileInfo << " " << realPath << " " << fileStat.st_mtime << " " << fileStat.st_size;
+		version += fileInfo.str();
+		break;
+	}
+
+	return version;
+}
+
 /*******************************************************************
 * Function: Client::parseFile()
 * Purpose : Sends parsefile command to the frontend
@@ -265,6 +305,11 @@ Revisions and bug fixes:
 std::string Client::shutdown()
 {
 	std::string reply = "";
+	
+	// nothing to do if the frontend was never started
+	if (!socketStream)
+		return reply;
+	
 	try
 	{
 		reply = sendCommand("<shutdown/>");
@@ -287,6 +332,10 @@ Revisions and bug fixes:
 */
 std::string Client::sendCommand(const char* command)
 {
+	// start the frontend on first use, so that cached runs never launch it
+	if (!socketStream)
+		openSocketStream(FRONTEND_DEFAULT_HOST, FRONTEND_DEFAULT_PORT);
+	
 	// acquire the mutual exclusion lock
 	pthread_mutex_lock(&mutex);
 	
@@ -63,6 +63,9 @@ public:
 	// connect to natlab
 	static void connect();
 	
+	// identifies the installed frontend version
+	static std::string getFrontendVersion();
+	
 private:
 	// private constructor, must not be called.
 	Client();
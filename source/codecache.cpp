@@ -0,0 +1,161 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <iostream>
+#include "codecache.h"
+#include "parsecache.h"
+#include "utility.h"
+
+// Config variable to enable/disable the code cache
+ConfigVar CodeCache::s_enableVar("code_cache_enable", ConfigVar::BOOL, "false");
+
+// Config variable for the cache directory (empty for the default)
+ConfigVar CodeCache::s_dirVar("code_cache_dir", ConfigVar::STRING, "");
+
+// Cache entry header signature
+const char CodeCache::ENTRY_SIGNATURE[] = "MCVMCC01";
+
+// Size of the cache entry signature
+static const size_t ENTRY_SIGNATURE_SIZE = 8;
+
+/***************************************************************
+* Function: CodeCache::initialize()
+* Purpose : Initialize the code cache
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void CodeCache::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_enableVar);
+	ConfigManager::registerVar(&s_dirVar);
+}
+
+/***************************************************************
+* Function: CodeCache::lookup()
+* Purpose : Look up the sections stored for a key
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool CodeCache::lookup(const std::string& keyText, SectionVector& sections)
+{
+	// If the cache is disabled, do nothing
+	if (s_enableVar.getBoolValue() == false)
+		return false;
+	
+	// Attempt to read the cache entry for this key
+	std::string entry;
+	if (!readBinaryFile(getEntryPath(keyText), entry))
+		return false;
+	
+	// If the entry header is incomplete or invalid, stop
+	if (entry.length() < ENTRY_SIGNATURE_SIZE + sizeof(uint64) || entry.compare(0, ENTRY_SIGNATURE_SIZE, ENTRY_SIGNATURE) != 0)
+		return false;
+	
+	// Read the key stored in the entry
+	size_t charIndex = ENTRY_SIGNATURE_SIZE;
+	uint64 keyLength = readUInt64(entry, charIndex);
+	
+	// If the stored key does not match, the entry is for another
+	// function version with the same key hash
+	if (keyLength != keyText.length() || keyLength > entry.length() - charIndex || entry.compare(charIndex, keyLength, keyText) != 0)
+		return false;
+	charIndex += keyLength;
+	
+	// Read the section count
+	if (entry.length() - charIndex < sizeof(uint64))
+		return false;
+	uint64 numSections = readUInt64(entry, charIndex);
+	
+	// Read each section
+	sections.clear();
+	for (uint64 i = 0; i < numSections; ++i)
+	{
+		// Read the section length
+		if (entry.length() - charIndex < sizeof(uint64))
+			return false;
+		uint64 length = readUInt64(entry, charIndex);
+		
+		// If the section is truncated, the entry is corrupted
+		if (length > entry.length() - charIndex)
+		{
+			std::cout << "WARNING: corrupted code cache entry \"" << getEntryPath(keyText) << "\"" << std::endl;
+			return false;
+		}
+		
+		// Extract the section contents
+		sections.push_back(entry.substr(charIndex, length));
+		charIndex += length;
+	}
+	
+	// The entry was read successfully
+	return true;
+}
+
+/***************************************************************
+* Function: CodeCache::store()
+* Purpose : Store sections for a key
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void CodeCache::store(const std::string& keyText, const SectionVector& sections)
+{
+	// If the cache is disabled, do nothing
+	if (s_enableVar.getBoolValue() == false)
+		return;
+	
+	// Get the path of the cache entry
+	std::string entryPath = getEntryPath(keyText);
+	
+	// Build the entry header with the full key text
+	std::string entry(ENTRY_SIGNATURE, ENTRY_SIGNATURE_SIZE);
+	appendUInt64(entry, keyText.length());
+	entry += keyText;
+	
+	// Append each section, preceded by its length
+	appendUInt64(entry, sections.size());
+	for (size_t i = 0; i < sections.size(); ++i)
+	{
+		appendUInt64(entry, sections[i].length());
+		entry += sections[i];
+	}
+	
+	// Write the entry
+	writeCacheEntry(entryPath, entry);
+}
+
+/***************************************************************
+* Function: CodeCache::getEntryPath()
+* Purpose : Get the cache entry path for a key
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string CodeCache::getEntryPath(const std::string& keyText)
+{
+	// Name the entry after the hash of the key
+	return getCacheEntryPath(
+		s_dirVar.getStringValue(),
+		ParseCache::hashBytes(keyText.data(), keyText.length()),
+		".mcc"
+	);
+}
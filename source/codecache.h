@@ -0,0 +1,70 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef CODECACHE_H_
+#define CODECACHE_H_
+
+// Header files
+#include <string>
+#include <vector>
+#include "platform.h"
+#include "configmanager.h"
+
+/***************************************************************
+* Class   : CodeCache
+* Purpose : Persistent on-disk cache of compiled function code
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class CodeCache
+{
+public:
+	
+	// Entry section vector type definition
+	typedef std::vector<std::string> SectionVector;
+	
+	// Method to initialize the code cache
+	static void initialize();
+	
+	// Method to test if the code cache is enabled
+	static bool isEnabled() { return s_enableVar.getBoolValue(); }
+	
+	// Method to look up the sections stored for a key
+	static bool lookup(const std::string& keyText, SectionVector& sections);
+	
+	// Method to store sections for a key
+	static void store(const std::string& keyText, const SectionVector& sections);
+	
+	// Config variable to enable/disable the code cache
+	static ConfigVar s_enableVar;
+	
+	// Config variable for the cache directory
+	static ConfigVar s_dirVar;
+	
+private:
+	
+	// Method to get the cache entry path for a key
+	static std::string getEntryPath(const std::string& keyText);
+	
+	// Cache entry header signature
+	static const char ENTRY_SIGNATURE[];
+};
+
+#endif // #ifndef CODECACHE_H_
@@ -1,4 +1,5 @@
 #include "dimvector.h"
+#include "profiling.h"
 #include <iostream>
 #include <cassert>
 using namespace std;
@@ -17,16 +18,30 @@ size_t& DimVector::operator[](int index){
 	return m_ptr[index];
 }
 
+// Ensure room for n dimensions, keeping the current values. Up to
+// INLINE_DIMS dimensions live in the object itself, so that creating
+// the size of a scalar or 2D matrix does not allocate. Larger vectors
+// spill to collected memory, which is never freed explicitly since
+// the owning objects are usually collected without being destroyed.
+void DimVector::grow(unsigned int n){
+	if(n<=m_cap) return;
+	unsigned int newCap = m_cap*2;
+	if(newCap<n) newCap = n;
+	PROF_INCR_COUNTER(Profiler::DIMVECTOR_ALLOC_COUNT);
+	size_t *temp_ptr = (size_t*)GC_MALLOC_ATOMIC(newCap*sizeof(size_t));
+	for(unsigned int i=0;i<m_n;i++){
+		temp_ptr[i] = m_ptr[i];
+	}
+	m_ptr = temp_ptr;
+	m_cap = newCap;
+}
+
 void DimVector::operator=(const DimVector& dv){
 	if(this==(&dv)) return;
-	if(m_n>0) delete[] m_ptr;
-	if(dv.m_n>0){
-		m_ptr = new size_t[dv.m_n];
-		for(unsigned int i=0;i<dv.m_n;i++){
-			m_ptr[i] = dv[i];
-		}
-	}else{
-		m_ptr = NULL;
+	m_n = 0;
+	grow(dv.m_n);
+	for(unsigned int i=0;i<dv.m_n;i++){
+		m_ptr[i] = dv[i];
 	}
 	m_n = dv.m_n;
 
@@ -34,94 +49,64 @@ void DimVector::operator=(const DimVector& dv){
 
 DimVector::DimVector(unsigned int s,size_t val){
 	//cout<<"Constructor 1 with "<<s<<" "<<val<<endl;
-	if(s<=0){
-		m_n=0;
-		m_ptr = NULL;
-	}else{
-		m_n = s;
-		m_ptr = new size_t[s];
-	}
+	m_n = 0;
+	m_ptr = m_inline;
+	m_cap = INLINE_DIMS;
+	grow(s);
 	for(unsigned int i=0;i<s;i++){
 		m_ptr[i] = val;
 	}
+	m_n = s;
 }
 
 DimVector::DimVector(size_t *ptr1,size_t *ptr2){
 	//cout<<"Constructor 2 with "<<(ptr2-ptr1)<<endl;
-	if(ptr1>=ptr2){
-		m_n = 0;
-		m_ptr = NULL;
-	}else{
-		ptrdiff_t diff = ptr2-ptr1;
-		m_n = (unsigned int)diff;
-		//cout<<"Trying to allocate "<<m_n<<" elements in DimVector constructor 2"<<endl;
-		m_ptr = new size_t[m_n];
-		for(unsigned int i=0;i<m_n;i++){
-			m_ptr[i] = ptr1[i];
-		}
+	m_n = 0;
+	m_ptr = m_inline;
+	m_cap = INLINE_DIMS;
+	if(ptr1>=ptr2) return;
+	ptrdiff_t diff = ptr2-ptr1;
+	grow((unsigned int)diff);
+	for(unsigned int i=0;i<(unsigned int)diff;i++){
+		m_ptr[i] = ptr1[i];
 	}
-
+	m_n = (unsigned int)diff;
 }
 
 DimVector::DimVector(const DimVector& dv){
 	//cout<<"Called copy constructor"<<endl;
-	m_n = dv.m_n;
-	if(m_n>0){
-		m_ptr = new (GC) size_t[m_n];
-		for(unsigned int i=0;i<m_n;i++){
-			m_ptr[i] = dv[i];
-		}
-	}else{
-		m_ptr = NULL;
+	m_n = 0;
+	m_ptr = m_inline;
+	m_cap = INLINE_DIMS;
+	grow(dv.m_n);
+	for(unsigned int i=0;i<dv.m_n;i++){
+		m_ptr[i] = dv[i];
 	}
+	m_n = dv.m_n;
 }
 
 DimVector::~DimVector(){
 	//cout<<"Called destructor"<<endl;
-	if(m_n>0) delete[] m_ptr;
 }
+
 void DimVector::insert(unsigned int location,size_t val){
 	//cout<<"Called insert with "<<location<<" "<<val<<" "<<m_n<<endl;
 	if(location>m_n) return;
-	size_t *temp_ptr = new size_t[m_n+1];
-	for(unsigned int i=0;i<location;i++){
-		temp_ptr[i] = m_ptr[i];
-	}
-	temp_ptr[location] = val;
-	for(unsigned int i=location+1;i<m_n+1;i++){
-		temp_ptr[i] = m_ptr[i-1];
+	grow(m_n+1);
+	for(unsigned int i=m_n;i>location;i--){
+		m_ptr[i] = m_ptr[i-1];
 	}
-	if(m_n>0) delete[] m_ptr;
-	m_ptr = temp_ptr;
+	m_ptr[location] = val;
 	m_n++;
 }
 
 void DimVector::resize(unsigned int n,size_t val){
 	//cout<<"Called resize with "<<n<<" "<<val<<endl;
 	//printDV(*this);
-	if(n==m_n) return;
-
-	if(n==0){
-		delete[] m_ptr;
-		m_n = 0;
-		return;
-	}
-
-	size_t *temp_ptr = new (GC) size_t[n];
-	if(n>m_n){
-		for(unsigned int i=0;i<m_n;i++){
-			temp_ptr[i] = m_ptr[i];
-		}
-		for(unsigned int i=m_n;i<n;i++){
-			temp_ptr[i] = val;
-		}
-	}else{
-		for(unsigned int i=0;i<n;i++){
-			temp_ptr[i] = m_ptr[i];
-		}		
+	grow(n);
+	for(unsigned int i=m_n;i<n;i++){
+		m_ptr[i] = val;
 	}
-	delete[] m_ptr;
-	m_ptr = temp_ptr;
 	m_n = n;
 	//printDV(*this);
 }
@@ -148,4 +133,5 @@ bool DimVector::operator!=(const DimVector& dv) const{
 
 void DimVector::reserve(size_t n){
 	//cout<<"Called reserve "<<n<<endl;
+	grow((unsigned int)n);
 }
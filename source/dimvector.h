@@ -12,6 +12,9 @@ class DimVector:public gc{
 	unsigned int m_n;
 	size_t *m_ptr;
 
+	// Number of dimensions stored inline, larger vectors spill to the heap
+	static const unsigned int INLINE_DIMS = 4;
+
 	unsigned int size() const{return m_n;}
 	bool empty() const{if(m_n==0) return true;else return false;}
 	size_t& back(){return m_ptr[m_n-1];}
@@ -36,5 +39,9 @@ class DimVector:public gc{
 	size_t& operator[](int index);
 	bool operator!=(const DimVector& dv) const;
 
+	private:
+	void grow(unsigned int n);
+	unsigned int m_cap;
+	size_t m_inline[INLINE_DIMS];
 };
 #endif
@@ -22,6 +22,34 @@
 #include "environment.h"
 #include "profiling.h"
 
+/***************************************************************
+* Function: SlotLayout::addSymbol()
+* Purpose : Add a symbol to the layout
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t SlotLayout::addSymbol(SymbolExpr* pSymbol)
+{
+	// If the symbol already has a slot, return its index
+	size_t slot = getSlot(pSymbol);
+	if (slot != NO_SLOT)
+		return slot;
+	
+	// Grow the slot table to cover the symbol number
+	size_t symId = pSymbol->getSymId();
+	if (symId >= m_slotsBySym.size())
+		m_slotsBySym.resize(symId + 1, NO_SLOT);
+	
+	// Assign the next slot index to the symbol
+	size_t index = m_symbols.size();
+	m_slotsBySym[symId] = index;
+	m_symbols.push_back(pSymbol);
+	
+	// Return the slot index
+	return index;
+}
+
 /***************************************************************
 * Function: Environment::Environment()
 * Purpose : Public constructor for environment class
@@ -30,7 +58,8 @@
 Revisions and bug fixes:
 */
 Environment::Environment()
-: m_pParent(NULL)
+: m_pLayout(NULL),
+  m_pParent(NULL)
 {
 }
 
@@ -44,10 +73,11 @@ Revisions and bug fixes:
 Environment* Environment::copy() const
 {
 	// Copy this environment object
-	Environment* pNewEnv = new Environment(m_pParent);
+	Environment* pNewEnv = new Environment(m_pParent, m_pLayout);
 	
 	// Copy the bindings
 	pNewEnv->m_bindings = m_bindings;
+	pNewEnv->m_slots = m_slots;
 	
 	// Return the new environment object
 	return pNewEnv;
@@ -62,6 +92,25 @@ Revisions and bug fixes:
 */
 void Environment::bind(Environment* pEnv, const SymbolExpr* pSymbol, DataObject* pObject)
 {
+	// If this environment has a slot layout
+	if (pEnv->m_pLayout != NULL)
+	{
+		// Get the slot index for this symbol
+		size_t slot = pEnv->m_pLayout->getSlot(pSymbol);
+		
+		// If the symbol has a slot
+		if (slot != SlotLayout::NO_SLOT)
+		{
+			// Grow the slot vector if the layout was extended
+			if (slot >= pEnv->m_slots.size())
+				pEnv->m_slots.resize(pEnv->m_pLayout->getNumSlots(), NULL);
+			
+			// Store the binding in the slot
+			pEnv->m_slots[slot] = pObject;
+			return;
+		}
+	}
+	
 	// Get a non-constant pointer for the symbol
 	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
 	
@@ -78,6 +127,25 @@ Revisions and bug fixes:
 */
 bool Environment::unbind(Environment* pEnv, const SymbolExpr* pSymbol)
 {
+	// If this environment has a slot layout
+	if (pEnv->m_pLayout != NULL)
+	{
+		// Get the slot index for this symbol
+		size_t slot = pEnv->m_pLayout->getSlot(pSymbol);
+		
+		// If the symbol has a slot
+		if (slot != SlotLayout::NO_SLOT)
+		{
+			// If the slot is not bound, the operation fails
+			if (slot >= pEnv->m_slots.size() || pEnv->m_slots[slot] == NULL)
+				return false;
+			
+			// Clear the slot
+			pEnv->m_slots[slot] = NULL;
+			return true;
+		}
+	}
+	
 	// Get a non-constant pointer for the symbol
 	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
 	
@@ -107,6 +175,34 @@ Revisions and bug fixes:
 */
 DataObject* Environment::lookup(const Environment* pEnv, const SymbolExpr* pSymbol)
 {
+	// If this environment has a slot layout
+	if (pEnv->m_pLayout != NULL)
+	{
+		// Get the slot index for this symbol
+		size_t slot = pEnv->m_pLayout->getSlot(pSymbol);
+		
+		// If the symbol has a slot
+		if (slot != SlotLayout::NO_SLOT)
+		{
+			// Get the object in the slot, if any
+			DataObject* pObject = (slot < pEnv->m_slots.size())? pEnv->m_slots[slot]:NULL;
+			
+			// If the slot is bound
+			if (pObject != NULL)
+			{
+				// Increment the environment lookup count
+				PROF_INCR_COUNTER(Profiler::ENV_LOOKUP_COUNT);
+				
+				// Return the object bound to this symbol
+				return pObject;
+			}
+			
+			// Slotted symbols are never in the binding map,
+			// lookup the binding in the parent environment
+			return (pEnv->m_pParent != NULL)? lookup(pEnv->m_pParent, pSymbol):NULL;
+		}
+	}
+	
 	// Get a non-constant pointer for the symbol
 	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
 	
@@ -147,6 +243,19 @@ Environment* Environment::extend(Environment* pParent)
 	return new Environment(pParent);
 }
 
+/***************************************************************
+* Function: static Environment::extendSlots()
+* Purpose : Extend an environment object using a slot layout
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+Environment* Environment::extendSlots(Environment* pParent, const SlotLayout* pLayout)
+{
+	// Return a new environment with slots for the layout's variables
+	return new Environment(pParent, pLayout);
+}
+
 /***************************************************************
 * Function: Environment::getSymbols()
 * Purpose : Get the symbols bound in this environment
@@ -166,6 +275,14 @@ Environment::SymbolVec Environment::getSymbols() const
 		symbols.push_back(itr->first);
 	}
 	
+	// For each bound slot
+	for (size_t i = 0; i < m_slots.size(); ++i)
+	{
+		// Add the slot's symbol to the vector
+		if (m_slots[i] != NULL)
+			symbols.push_back(m_pLayout->getSymbol(i));
+	}
+	
 	// Return the vector of symbols
 	return symbols;
 }
@@ -177,7 +294,11 @@ Environment::SymbolVec Environment::getSymbols() const
 ****************************************************************
 Revisions and bug fixes:
 */
-Environment::Environment(Environment* pParent)
-: m_pParent(pParent)
+Environment::Environment(Environment* pParent, const SlotLayout* pLayout)
+: m_pLayout(pLayout),
+  m_pParent(pParent)
 {
+	// Allocate one empty slot per variable of the layout
+	if (pLayout != NULL)
+		m_slots.resize(pLayout->getNumSlots(), NULL);
 }
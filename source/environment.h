@@ -28,6 +28,46 @@
 #include "objects.h"
 #include "utility.h"
 
+/***************************************************************
+* Class   : SlotLayout
+* Purpose : Map the variables of a function to fixed slots
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class SlotLayout : public gc
+{
+public:
+	
+	// Slot value indicating a symbol has no slot
+	static const size_t NO_SLOT = size_t(-1);
+	
+	// Method to add a symbol to the layout
+	size_t addSymbol(SymbolExpr* pSymbol);
+	
+	// Method to get the slot index of a symbol
+	size_t getSlot(const SymbolExpr* pSymbol) const
+	{
+		// Index the slot table with the unique number of the symbol
+		size_t symId = pSymbol->getSymId();
+		return (symId < m_slotsBySym.size())? m_slotsBySym[symId]:NO_SLOT;
+	}
+	
+	// Accessor to get the symbol stored in a slot
+	SymbolExpr* getSymbol(size_t index) const { return m_symbols[index]; }
+	
+	// Accessor to get the number of slots
+	size_t getNumSlots() const { return m_symbols.size(); }
+	
+private:
+	
+	// Slot index of each symbol, by symbol number (NO_SLOT if none)
+	std::vector<size_t, gc_allocator<size_t> > m_slotsBySym;
+	
+	// Symbol stored in each slot
+	std::vector<SymbolExpr*, gc_allocator<SymbolExpr*> > m_symbols;
+};
+
 /***************************************************************
 * Class   : Environment
 * Purpose : Represent an execution environment
@@ -60,19 +100,34 @@ public:
 	// Method to extend an environment object
 	static Environment* extend(Environment* pParent);
 	
+	// Method to extend an environment object using a slot layout
+	static Environment* extendSlots(Environment* pParent, const SlotLayout* pLayout);
+	
 	// Method to get the symbols bound in this environment
 	SymbolVec getSymbols() const;
 	
+	// Accessor to get the parent environment (null if none)
+	Environment* getParent() const { return m_pParent; }
+	
 private:
 	
 	// Private constructor for extension
-	Environment(Environment* pParent);
+	Environment(Environment* pParent, const SlotLayout* pLayout = NULL);
 	
 	// Symbol map type definition
 	typedef __gnu_cxx::hash_map<SymbolExpr*, DataObject*, IntHashFunc<SymbolExpr*>, __gnu_cxx::equal_to<SymbolExpr*>, gc_allocator<DataObject*> > SymbolMap;
 	
+	// Slot vector type definition
+	typedef std::vector<DataObject*, gc_allocator<DataObject*> > SlotVector;
+	
 	// Bindings of the environment
 	SymbolMap m_bindings;
+	
+	// Layout of the variable slots (null if none)
+	const SlotLayout* m_pLayout;
+	
+	// Objects bound to the variable slots
+	SlotVector m_slots;
 
 	// Pointer to parent environment
 	Environment* m_pParent;
@@ -46,7 +46,10 @@ ProgFunction::ProgFunction(
 : m_inputParams(inParams), 
   m_outputParams(outParams),
   m_nestedFuncs(nestedFuncs),
+  m_pSlotLayout(new SlotLayout()),
   m_pParent(NULL),
+  m_pClosureCode(NULL),
+  m_pCapturedVals(NULL),
   m_nextTempId(0)
 { 
 	// Indicate that this is a program function
@@ -75,6 +78,24 @@ ProgFunction::ProgFunction(
 		m_pCurrentBody = splitSequence(m_pCurrentBody, this);
 	}		
 	
+	// Assign slots to the input and output parameters
+	for (ParamVector::const_iterator itr = m_inputParams.begin(); itr != m_inputParams.end(); ++itr)
+		m_pSlotLayout->addSymbol(*itr);
+	for (ParamVector::const_iterator itr = m_outputParams.begin(); itr != m_outputParams.end(); ++itr)
+		m_pSlotLayout->addSymbol(*itr);
+	
+	// Assign slots to the nargin and nargout variables
+	if (Interpreter::getNarginSym() != NULL)
+	{
+		m_pSlotLayout->addSymbol(Interpreter::getNarginSym());
+		m_pSlotLayout->addSymbol(Interpreter::getNargoutSym());
+	}
+	
+	// Assign slots to the variables written in the function body
+	Expression::SymbolSet bodyDefs = m_pCurrentBody->getSymbolDefs();
+	for (Expression::SymbolSet::iterator itr = bodyDefs.begin(); itr != bodyDefs.end(); ++itr)
+		m_pSlotLayout->addSymbol(*itr);
+	
 	// Store the script flag value
 	m_isScript = isScript;
 	
@@ -199,8 +220,14 @@ SymbolExpr* ProgFunction::createTemp()
 	// Concatenate the variable name
 	std::string varName = TEMP_VAR_PREFIX + ::toString(tempId);
 	
-	// Return a symbol object for this variable name
-	return SymbolExpr::getSymbol(varName);
+	// Get the symbol object for this variable name
+	SymbolExpr* pTempVar = SymbolExpr::getSymbol(varName);
+	
+	// Give the temporary its own variable slot
+	m_pSlotLayout->addSymbol(pTempVar);
+	
+	// Return the symbol object
+	return pTempVar;
 }
 
 /***************************************************************
@@ -168,6 +168,9 @@ public:
 	// Static method to set the local environment of a function
 	static void setLocalEnv(ProgFunction* pFunc, Environment* pEnv) { pFunc->m_pLocalEnv = pEnv; }
 	
+	// Mutator to set the shared code function and captured values of a closure
+	void setClosureCode(ProgFunction* pCode, ArrayObj* pCapturedVals) { m_pClosureCode = pCode; m_pCapturedVals = pCapturedVals; }
+	
 	// Accessor to get the input parameters
 	const ParamVector& getInParams() const { return m_inputParams; }
 	
@@ -186,6 +189,9 @@ public:
 	// Static method to get the local environment
 	static Environment* getLocalEnv(const ProgFunction* pFunc) { return pFunc->m_pLocalEnv; }
 	
+	// Accessor to get the variable slot layout
+	const SlotLayout* getSlotLayout() const { return m_pSlotLayout; }
+	
 	// Accessor to get the script flag
 	bool isScript() const { return m_isScript; }
 	
@@ -195,6 +201,12 @@ public:
 	// Accessor to get the parent function pointer
 	ProgFunction* getParent() const { return m_pParent; }
 	
+	// Accessor to get the shared code function of a closure (null if none)
+	ProgFunction* getClosureCode() const { return m_pClosureCode; }
+	
+	// Accessor to get the values captured by a closure
+	ArrayObj* getCapturedVals() const { return m_pCapturedVals; }
+	
 private:
 
 	// Input parameters
@@ -215,6 +227,9 @@ private:
 	// Local function environment
 	Environment* m_pLocalEnv;
 	
+	// Slot layout of the function's variables
+	SlotLayout* m_pSlotLayout;
+	
 	// Indicates if the function is a script
 	bool m_isScript;
 	
@@ -224,6 +239,12 @@ private:
 	// Pointer to the parent function (null if none)
 	ProgFunction* m_pParent;
 	
+	// Shared code function taking the captured variables as inputs (null if none)
+	ProgFunction* m_pClosureCode;
+	
+	// Values captured by the closure, in code function input order
+	ArrayObj* m_pCapturedVals;
+	
 	// Next available temp variable id
 	size_t m_nextTempId;
 };
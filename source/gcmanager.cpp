@@ -0,0 +1,219 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <gc.h>
+#include <algorithm>
+#include <iostream>
+#include "gcmanager.h"
+#include "profiling.h"
+#include "interpreter.h"
+#include "cellarrayobj.h"
+#include "chararrayobj.h"
+
+// Collection events, which give the end of each collection, appeared in
+// Boehm GC 7.6, older collectors only report the start of collections
+#if GC_VERSION_MAJOR > 7 || (GC_VERSION_MAJOR == 7 && GC_VERSION_MINOR >= 6)
+#define MCVM_GC_COLLECTION_EVENTS
+#endif
+
+// Library function to get the collector statistics
+LibFunction GCManager::s_gcStatsCmd("mcvm_gc_stats", GCManager::gcStatsCmd);
+
+// Config variable to enable incremental (generational) collection
+ConfigVar GCManager::s_incrementalVar("gc_incremental", ConfigVar::BOOL, "false");
+
+// Config variable for the initial heap size, in megabytes
+ConfigVar GCManager::s_initialHeapVar("gc_initial_heap", ConfigVar::INT, "0", 0);
+
+// Config variable for the free space divisor (0 keeps the default)
+ConfigVar GCManager::s_freeSpaceDivisorVar("gc_free_space_divisor", ConfigVar::INT, "0", 0, 100);
+
+// Start time of the collection in progress
+float64 GCManager::s_pauseStart = 0;
+
+// Number of collections, total and longest pause since startup
+uint64 GCManager::s_numCollections = 0;
+float64 GCManager::s_totalPause = 0;
+float64 GCManager::s_maxPause = 0;
+
+#ifdef MCVM_GC_COLLECTION_EVENTS
+/***************************************************************
+* Function: onCollectionEvent()
+* Purpose : Collector callback for collection events
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void onCollectionEvent(GC_EventType eventType)
+{
+	// Note the start and end of collections, ignore the other phases
+	if (eventType == GC_EVENT_START)
+		GCManager::collectionStarted();
+	else if (eventType == GC_EVENT_END)
+		GCManager::collectionEnded();
+}
+#endif
+
+/***************************************************************
+* Function: GCManager::initialize()
+* Purpose : Initialize the GC manager
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_incrementalVar);
+	ConfigManager::registerVar(&s_initialHeapVar);
+	ConfigManager::registerVar(&s_freeSpaceDivisorVar);
+	
+	// Register the local library functions
+	Interpreter::setBinding(s_gcStatsCmd.getFuncName(), (DataObject*)&s_gcStatsCmd);
+	
+	// Have the collector report its collections
+	#ifdef MCVM_GC_COLLECTION_EVENTS
+	GC_set_on_collection_event(onCollectionEvent);
+	#else
+	GC_set_start_callback(collectionStarted);
+	#endif
+}
+
+/***************************************************************
+* Function: GCManager::configure()
+* Purpose : Apply the collector settings
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::configure()
+{
+	// If a free space divisor was specified, set it
+	// Larger values collect more often, with a smaller heap
+	if (s_freeSpaceDivisorVar.getIntValue() > 0)
+		GC_set_free_space_divisor(s_freeSpaceDivisorVar.getIntValue());
+	
+	// Compute the requested initial heap size in bytes
+	size_t initialHeap = size_t(s_initialHeapVar.getIntValue()) * 1024 * 1024;
+	
+	// If the heap is smaller than requested, expand it now, so
+	// that startup does not trigger a series of small collections
+	size_t heapSize = GC_get_heap_size();
+	if (initialHeap > heapSize && GC_expand_hp(initialHeap - heapSize) == 0)
+		std::cout << "WARNING: could not expand the heap to the initial size" << std::endl;
+	
+	// If incremental collection is requested, enable it, this also
+	// makes the collector generational, using virtual dirty bits
+	if (s_incrementalVar.getBoolValue())
+		GC_enable_incremental();
+}
+
+/***************************************************************
+* Function: GCManager::collectionStarted()
+* Purpose : Note the start of a collection
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::collectionStarted()
+{
+	// Store the start time of the collection
+	s_pauseStart = Profiler::getTimeSeconds();
+	
+	// Increment the collection counts
+	++s_numCollections;
+	PROF_INCR_COUNTER(Profiler::GC_COLLECTION_COUNT);
+}
+
+/***************************************************************
+* Function: GCManager::collectionEnded()
+* Purpose : Note the end of a collection
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::collectionEnded()
+{
+	// Compute the duration of the pause
+	float64 pauseSecs = Profiler::getTimeSeconds() - s_pauseStart;
+	
+	// Update the pause times since startup
+	s_totalPause += pauseSecs;
+	s_maxPause = std::max(s_maxPause, pauseSecs);
+	
+	// Update the pause timers of the profiling context
+	Profiler::recordGCPause(pauseSecs);
+}
+
+/***************************************************************
+* Function: static GCManager::gcStatsCmd()
+* Purpose : Library function to get the collector statistics
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+ArrayObj* GCManager::gcStatsCmd(ArrayObj* pArguments)
+{
+	// Ensure that the argument count is valid
+	if (pArguments->getSize() != 0)
+		throw RunError("too many arguments");
+	
+	// Statistic names
+	static const char* STAT_NAMES[] =
+	{
+		"heap size (bytes)",
+		"free bytes",
+		"bytes allocated since gc",
+		"total bytes allocated",
+		"collections",
+		"incremental mode",
+		"total pause (s)",
+		"max pause (s)"
+	};
+	
+	// Statistic values
+	float64 statValues[] =
+	{
+		float64(GC_get_heap_size()),
+		float64(GC_get_free_bytes()),
+		float64(GC_get_bytes_since_gc()),
+		float64(GC_get_total_bytes()),
+		float64(s_numCollections),
+		float64(s_incrementalVar.getBoolValue()),
+		s_totalPause,
+		s_maxPause
+	};
+	
+	// Get the number of statistics
+	const size_t numStats = sizeof(statValues) / sizeof(statValues[0]);
+	
+	// Create a cell array with two columns to store the statistics
+	CellArrayObj* pOutGrid = new CellArrayObj(numStats, 2);
+	
+	// For each statistic
+	for (size_t i = 0; i < numStats; ++i)
+	{
+		// Write the statistic name and value
+		pOutGrid->setElem2D(i+1, 1, new CharArrayObj(STAT_NAMES[i]));
+		pOutGrid->setElem2D(i+1, 2, new MatrixF64Obj(statValues[i]));
+	}
+	
+	// Return the cell array
+	return new ArrayObj(pOutGrid);
+}
@@ -0,0 +1,75 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef GCMANAGER_H_
+#define GCMANAGER_H_
+
+// Header files
+#include "platform.h"
+#include "configmanager.h"
+#include "functions.h"
+
+/***************************************************************
+* Class   : GCManager
+* Purpose : Configure the garbage collector and track its pauses
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class GCManager
+{
+public:
+	
+	// Method to initialize the GC manager
+	static void initialize();
+	
+	// Method to apply the collector settings, once the
+	// command-line arguments have been parsed
+	static void configure();
+	
+	// Library function to get the collector statistics
+	static ArrayObj* gcStatsCmd(ArrayObj* pArguments);
+	static LibFunction s_gcStatsCmd;
+	
+	// Config variable to enable incremental (generational) collection
+	static ConfigVar s_incrementalVar;
+	
+	// Config variable for the initial heap size, in megabytes
+	static ConfigVar s_initialHeapVar;
+	
+	// Config variable for the free space divisor (0 keeps the default)
+	static ConfigVar s_freeSpaceDivisorVar;
+	
+	// Methods to note the start and end of a collection, called by
+	// the collector with the world stopped, these must not allocate
+	static void collectionStarted();
+	static void collectionEnded();
+	
+private:
+	
+	// Start time of the collection in progress
+	static float64 s_pauseStart;
+	
+	// Number of collections, total and longest pause since startup
+	static uint64 s_numCollections;
+	static float64 s_totalPause;
+	static float64 s_maxPause;
+};
+
+#endif // #ifndef GCMANAGER_H_
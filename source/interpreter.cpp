@@ -20,8 +20,10 @@
 #include <iostream>
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
 #include "interpreter.h"
 #include "jitcompiler.h"
+#include "arrayfusion.h"
 #include "parser.h"
 #include "matrixobjs.h"
 #include "matrixops.h"
@@ -31,6 +33,7 @@
 #include "rangeexpr.h"
 #include "constexprs.h"
 #include "cellindexexpr.h"
+#include "analysis_livevars.h"
 
 // Static  type inference validation config variable
 ConfigVar Interpreter::s_validateTypes("validate_type_infer", ConfigVar::BOOL, "false");
@@ -38,6 +41,15 @@ ConfigVar Interpreter::s_validateTypes("validate_type_infer", ConfigVar::BOOL, "
 // Config variable to enable/disable type inference profiling
 ConfigVar Interpreter::s_profTypeInfer("profile_type_infer", ConfigVar::BOOL, "false");
 
+// Config variable to enable/disable the unboxed scalar path
+ConfigVar Interpreter::s_unboxedScalarsVar("unboxed_scalars", ConfigVar::BOOL, "true");
+
+// Config variable to drop variable bindings after their last use
+ConfigVar Interpreter::s_releaseDeadVarsVar("release_dead_vars", ConfigVar::BOOL, "true");
+
+// Config variable to free the buffers of dead, unshared matrices
+ConfigVar Interpreter::s_freeDeadBuffersVar("free_dead_buffers", ConfigVar::BOOL, "false");
+
 // Static global environment variable
 Environment Interpreter::s_globalEnv;
 
@@ -51,6 +63,15 @@ Interpreter::TypeInfoStack Interpreter::s_typeInfoStack;
 // Static set used for type inference output
 Interpreter::ViewedStmtSet Interpreter::s_viewedStmtSet;
 
+// Static map of shared closure code functions
+Interpreter::LambdaCodeMap Interpreter::s_lambdaCodeMap;
+
+// Static map of dead variable info, per function body
+Interpreter::DeadVarInfoMap Interpreter::s_deadVarInfoMap;
+
+// Dead variable info of the function being interpreted
+const Interpreter::DeadVarInfo* Interpreter::s_pDeadVarInfo = NULL;
+
 /***************************************************************
 * Function: Interpreter::initialize()
 * Purpose : Initialize the interpreter
@@ -63,6 +84,9 @@ void Interpreter::initialize()
 	// Register the local config variables
 	ConfigManager::registerVar(&s_validateTypes);
 	ConfigManager::registerVar(&s_profTypeInfer);
+	ConfigManager::registerVar(&s_unboxedScalarsVar);
+	ConfigManager::registerVar(&s_releaseDeadVarsVar);
+	ConfigManager::registerVar(&s_freeDeadBuffersVar);
 
 	// Get the static "nargin" and "nargout" symbol object
 	s_pNarginSym = SymbolExpr::getSymbol("nargin");
@@ -132,7 +156,7 @@ ArrayObj* Interpreter::callByName(const std::string& funcName, ArrayObj* pArgume
 ****************************************************************
 Revisions and bug fixes:
 */
-ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, size_t nargout)
+ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, size_t nargout, const ParamExpr* pCallSite)
 {
 	// Increment the function call count
 	PROF_INCR_COUNTER(Profiler::FUNC_CALL_COUNT);
@@ -141,7 +165,7 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 	try
 	{
 		// Declare an array object to store the output values
-		ArrayObj* pOutput;
+		ArrayObj* pOutput = NULL;
 
 		// If this is a program function
 		if (pFunction->isProgFunction())
@@ -149,18 +173,42 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 			// Get a typed pointer to the program function
 			ProgFunction* pProgFunc = (ProgFunction*)pFunction;
 			
-			// If JIT compilation is enabled and this is not a script nor a closure
+			// If JIT compilation is enabled, this is a closure with shared code
+			// and all of the closure's input arguments are specified
 			if (JITCompiler::s_jitEnableVar.getBoolValue() == true &&
-				pProgFunc->isScript() == false && 
-				pProgFunc->isClosure() == false
+				pProgFunc->isClosure() == true &&
+				pProgFunc->getClosureCode() != NULL &&
+				pArguments->getSize() == pProgFunc->getInParams().size()
 			)
 			{
-				// Call a JIT-compiled version of the function
-				pOutput = JITCompiler::callFunction(pProgFunc, pArguments, nargout);
+				// Get a pointer to the shared code function
+				ProgFunction* pCodeFunc = pProgFunc->getClosureCode();
+				
+				// Pass the captured values after the call arguments
+				ArrayObj* pCodeArgs = new ArrayObj(pArguments->getSize() + pProgFunc->getCapturedVals()->getSize());
+				ArrayObj::append(pCodeArgs, pArguments);
+				ArrayObj::append(pCodeArgs, pProgFunc->getCapturedVals());
+				
+				// Call a JIT-compiled version of the code function, if it is ready
+				// NOTE: the other free symbols of the closure resolve the same way
+				//       in the code function's own local environment
+				pOutput = JITCompiler::callFunction(pCodeFunc, pCodeArgs, nargout, pCallSite, true);
+			}
+			
+			// Otherwise, if JIT compilation is enabled
+			else if (JITCompiler::s_jitEnableVar.getBoolValue() == true)
+			{
+				// Call a JIT-compiled version of the function, if it is ready
+				// NOTE: scripts run directly in their local environment and
+				//       closures without shared code read captured variables
+				//       from their environment
+				pOutput = JITCompiler::callFunction(pProgFunc, pArguments, nargout, pCallSite, true);
 			}
 
-			// Otherwise, the function will be interpreted
-			else
+			// If the function was not run in compiled code, it will be interpreted
+			// NOTE: with tiered compilation, functions are interpreted until they
+			//       are hot and while their code is generated in the background
+			if (pOutput == NULL)
 			{
 				// Get a reference to the input parameter vector
 				const ProgFunction::ParamVector& inParams = pProgFunc->getInParams();
@@ -185,8 +233,9 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 				}
 				else
 				{
-					// Extend the local environment for the call
-					pCallEnv = Environment::extend(pLocalEnv);
+					// Extend the local environment for the call, with
+					// slots for the function's variables
+					pCallEnv = Environment::extendSlots(pLocalEnv, pProgFunc->getSlotLayout());
 				}
 
 				// If there are too many input arguments, throw an exception
@@ -243,17 +292,32 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 					s_typeInfoStack.push(funcTypeInfo);
 				}
 
-				// Setup a try block to catch return exceptions
+				// Save the dead variable info of the calling function
+				const DeadVarInfo* pPrevDeadVarInfo = s_pDeadVarInfo;
+				
+				// If enabled, release the variables of this function after their
+				// last use, scripts share their environment with the caller
+				if (s_releaseDeadVarsVar.getBoolValue() == true && pProgFunc->isScript() == false)
+					s_pDeadVarInfo = getDeadVarInfo(pProgFunc);
+				else
+					s_pDeadVarInfo = NULL;
+				
+				// Execute the sequence statement in the calling environment,
+				// a return statement simply ends the execution of the body
 				try
 				{
-					// Execute the sequence statement in the calling environment
 					execSeqStmt(pSeqStmt, pCallEnv);
 				}
-
-				// Catch return exceptions
-				catch (ReturnExcept e)
+				
+				// Restore the dead variable info of the caller on errors
+				catch (...)
 				{
+					s_pDeadVarInfo = pPrevDeadVarInfo;
+					throw;
 				}
+				
+				// Restore the dead variable info of the calling function
+				s_pDeadVarInfo = pPrevDeadVarInfo;
 
 				// If type inference validation is enabled
 				if (validateTypes == true)
@@ -329,7 +393,7 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 ****************************************************************
 Revisions and bug fixes:
 */
-void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
+Interpreter::ExecStatus Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 {
 	// If type inference validation is enabled
 	if (s_validateTypes.getBoolValue() == true)
@@ -567,6 +631,9 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 		}
 	}
 
+	// Declare a variable for the completion status of the statement
+	ExecStatus status = EXEC_NORMAL;
+
 	// Switch on the statement type
 	switch (pStmt->getStmtType())
 	{
@@ -574,7 +641,7 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 		case Statement::IF_ELSE:
 		{
 			// Evaluate the if-else statement
-			evalIfStmt((IfElseStmt*)pStmt, pEnv);
+			status = evalIfStmt((IfElseStmt*)pStmt, pEnv);
 		}
 		break;
 
@@ -582,34 +649,31 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 		case Statement::LOOP:
 		{
 			// Evaluate the loop statement
-			evalLoopStmt((LoopStmt*)pStmt, pEnv);
+			status = evalLoopStmt((LoopStmt*)pStmt, pEnv);
 		}
 		break;
 
 		// Break statement
 		case Statement::BREAK:
 		{
-			// Throw a break exception, to be caught
-			// inside the loop
-			throw BreakExcept();
+			// Signal the break to the enclosing loop
+			return EXEC_BREAK;
 		}
 		break;
 
 		// Continue statement
 		case Statement::CONTINUE:
 		{
-			// Throw a continue exception, to be caught
-			// inside the loop
-			throw ContinueExcept();
+			// Signal the continue to the enclosing loop
+			return EXEC_CONTINUE;
 		}
 		break;
 
 		// Return statement
 		case Statement::RETURN:
 		{
-			// Throw a return exception, to be caught
-			// at the function call point
-			throw ReturnExcept();
+			// Signal the return to the function call point
+			return EXEC_RETURN;
 		}
 		break;
 
@@ -636,6 +700,10 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 			throw RunError("unexpected statement type", pStmt);
 		}
 	}
+	
+	// If control is leaving the statement early, propagate the status
+	if (status != EXEC_NORMAL)
+		return status;
 		
 	// If type inference validation is enabled
 	if (s_validateTypes.getBoolValue() == true && s_typeInfoStack.empty() == false)
@@ -731,6 +799,9 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 			}
 		}
 	}	
+	
+	// The statement completed normally
+	return EXEC_NORMAL;
 }
 
 /***************************************************************
@@ -740,7 +811,7 @@ void Interpreter::execStatement(const Statement* pStmt, Environment* pEnv)
 ****************************************************************
 Revisions and bug fixes:
 */
-void Interpreter::execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv)
+Interpreter::ExecStatus Interpreter::execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv)
 {
 	// Get a reference to the statement vector
 	const StmtSequence::StmtVector& stmtVector = pSeqStmt->getStatements();
@@ -749,7 +820,312 @@ void Interpreter::execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv)
 	for (StmtSequence::StmtVector::const_iterator itr = stmtVector.begin(); itr != stmtVector.end(); ++itr)
 	{
 		// Execute this statement
-		execStatement(*itr, pEnv);
+		ExecStatus status = execStatement(*itr, pEnv);
+		
+		// If this statement is a break, continue or return, stop here
+		if (status != EXEC_NORMAL)
+			return status;
+		
+		// If liveness information is available, release the
+		// variables whose last use was this statement
+		if (s_pDeadVarInfo != NULL)
+			releaseDeadVars(*itr, pEnv);
+	}
+	
+	// The sequence completed normally
+	return EXEC_NORMAL;
+}
+
+/***************************************************************
+* Function: Interpreter::getDeadVarInfo()
+* Purpose : Get the dead variable info for a function
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const Interpreter::DeadVarInfo* Interpreter::getDeadVarInfo(ProgFunction* pFunction)
+{
+	// Get a pointer to the function body
+	const StmtSequence* pFuncBody = pFunction->getCurrentBody();
+	
+	// If the info for this body was already computed, return it
+	DeadVarInfoMap::iterator infoItr = s_deadVarInfoMap.find(pFuncBody);
+	if (infoItr != s_deadVarInfoMap.end())
+		return infoItr->second;
+	
+	// Create a new dead variable info object
+	DeadVarInfo* pInfo = new DeadVarInfo();
+	s_deadVarInfoMap[pFuncBody] = pInfo;
+	
+	// Nested functions, closures and function handles may read the
+	// environment of this function after the last use of a variable
+	// in its body, liveness cannot be trusted, leave the info empty
+	if (pFunction->getParent() != NULL || pFunction->getNestedFuncs().empty() == false || hasClosures(pFuncBody))
+		return pInfo;
+	
+	// Names of the functions accessing variables by name
+	static const char* DYNAMIC_ACCESS_FUNCS[] =
+	{
+		"eval", "evalin", "assignin", "exist", "who", "whos", "save", "load", "clear", "inputname"
+	};
+	
+	// Get the symbols used by the function body
+	Expression::SymbolSet bodyUses = pFuncBody->getSymbolUses();
+	
+	// For each symbol used
+	for (Expression::SymbolSet::iterator useItr = bodyUses.begin(); useItr != bodyUses.end(); ++useItr)
+	{
+		// If this symbol names a function accessing variables by name,
+		// liveness cannot be trusted, leave the info empty
+		for (size_t i = 0; i < sizeof(DYNAMIC_ACCESS_FUNCS) / sizeof(DYNAMIC_ACCESS_FUNCS[0]); ++i)
+			if ((*useItr)->getSymName() == DYNAMIC_ACCESS_FUNCS[i])
+				return pInfo;
+	}
+	
+	// Perform a live variable analysis on the function body
+	// Note: liveness does not depend on the argument types
+	const LiveVarInfo* pLiveVarInfo = (const LiveVarInfo*)AnalysisManager::requestInfo(
+		&computeLiveVars,
+		pFunction,
+		pFuncBody,
+		TypeSetString()
+	);
+	
+	// Find the variables dying at each statement of the body
+	findDeadVars(pFuncBody, pLiveVarInfo->liveVarMap, pInfo->deadVars);
+	
+	// Return the dead variable info
+	return pInfo;
+}
+
+/***************************************************************
+* Function: Interpreter::findDeadVars()
+* Purpose : Find the variables dying at each statement
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Interpreter::findDeadVars(const StmtSequence* pSeqStmt, const LiveVarMap& liveVars, DeadVarMap& deadVars)
+{
+	// Get a reference to the statement vector
+	const StmtSequence::StmtVector& stmts = pSeqStmt->getStatements();
+	
+	// Live set after the previous statement (null if none)
+	const Expression::SymbolSet* pPrevLiveSet = NULL;
+	
+	// For each statement
+	for (StmtSequence::StmtVector::const_iterator stmtItr = stmts.begin(); stmtItr != stmts.end(); ++stmtItr)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = *stmtItr;
+		
+		// Find the statements nested in this one
+		if (pStmt->getStmtType() == Statement::IF_ELSE)
+		{
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+			findDeadVars(pIfStmt->getIfBlock(), liveVars, deadVars);
+			findDeadVars(pIfStmt->getElseBlock(), liveVars, deadVars);
+		}
+		else if (pStmt->getStmtType() == Statement::LOOP)
+		{
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+			findDeadVars(pLoopStmt->getInitSeq(), liveVars, deadVars);
+			findDeadVars(pLoopStmt->getTestSeq(), liveVars, deadVars);
+			findDeadVars(pLoopStmt->getBodySeq(), liveVars, deadVars);
+			findDeadVars(pLoopStmt->getIncrSeq(), liveVars, deadVars);
+		}
+		
+		// Get the live variables after this statement
+		LiveVarMap::const_iterator liveItr = liveVars.find(pStmt);
+		
+		// If there is no liveness information for this statement, skip it
+		if (liveItr == liveVars.end())
+		{
+			pPrevLiveSet = NULL;
+			continue;
+		}
+		const Expression::SymbolSet& liveSet = liveItr->second;
+		
+		// The variables that may die here are those live before
+		// the statement, and those the statement uses or defines
+		Expression::SymbolSet candidates = pStmt->getSymbolUses();
+		Expression::SymbolSet defs = pStmt->getSymbolDefs();
+		candidates.insert(defs.begin(), defs.end());
+		if (pPrevLiveSet != NULL)
+			candidates.insert(pPrevLiveSet->begin(), pPrevLiveSet->end());
+		
+		// Add the candidates no longer live to the dead variable list
+		for (Expression::SymbolSet::iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+			if (liveSet.find(*itr) == liveSet.end())
+				deadVars[pStmt].push_back(*itr);
+		
+		// Update the previous live set
+		pPrevLiveSet = &liveSet;
+	}
+}
+
+/***************************************************************
+* Function: Interpreter::hasClosures(StmtSequence)
+* Purpose : Test if a sequence may capture its environment
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::hasClosures(const StmtSequence* pSeqStmt)
+{
+	// Get a reference to the statement vector
+	const StmtSequence::StmtVector& stmts = pSeqStmt->getStatements();
+	
+	// Test each statement of the sequence
+	for (StmtSequence::StmtVector::const_iterator itr = stmts.begin(); itr != stmts.end(); ++itr)
+		if (hasClosures(*itr))
+			return true;
+	
+	// No closures were found
+	return false;
+}
+
+/***************************************************************
+* Function: Interpreter::hasClosures(Statement)
+* Purpose : Test if a statement may capture its environment
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::hasClosures(const Statement* pStmt)
+{
+	// Switch on the statement type
+	switch (pStmt->getStmtType())
+	{
+		// Assignment statement
+		case Statement::ASSIGN:
+		{
+			// Test the left and right expressions
+			const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+			const AssignStmt::ExprVector& leftExprs = pAssignStmt->getLeftExprs();
+			for (AssignStmt::ExprVector::const_iterator itr = leftExprs.begin(); itr != leftExprs.end(); ++itr)
+				if (hasClosures(*itr))
+					return true;
+			return hasClosures(pAssignStmt->getRightExpr());
+		}
+		
+		// Expression statement
+		case Statement::EXPR:
+		return hasClosures(((const ExprStmt*)pStmt)->getExpression());
+		
+		// If-else statement
+		case Statement::IF_ELSE:
+		{
+			// Test the condition and both blocks
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+			return
+				hasClosures(pIfStmt->getCondition()) ||
+				hasClosures(pIfStmt->getIfBlock()) ||
+				hasClosures(pIfStmt->getElseBlock());
+		}
+		
+		// Loop statement
+		case Statement::LOOP:
+		{
+			// Test the loop sequences
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+			return
+				hasClosures(pLoopStmt->getInitSeq()) ||
+				hasClosures(pLoopStmt->getTestSeq()) ||
+				hasClosures(pLoopStmt->getBodySeq()) ||
+				hasClosures(pLoopStmt->getIncrSeq());
+		}
+		
+		// Statements without expressions
+		case Statement::BREAK:
+		case Statement::CONTINUE:
+		case Statement::RETURN:
+		return false;
+		
+		// Other statements are not expected here, be conservative
+		default:
+		return true;
+	}
+}
+
+/***************************************************************
+* Function: Interpreter::hasClosures(Expression)
+* Purpose : Test if an expression may capture its environment
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::hasClosures(const Expression* pExpr)
+{
+	// Missing sub-expressions capture nothing
+	if (pExpr == NULL)
+		return false;
+	
+	// Lambda expressions and function handles may capture the environment
+	if (pExpr->getExprType() == Expression::LAMBDA || pExpr->getExprType() == Expression::FN_HANDLE)
+		return true;
+	
+	// Test the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (Expression::ExprVector::iterator itr = subExprs.begin(); itr != subExprs.end(); ++itr)
+		if (hasClosures(*itr))
+			return true;
+	
+	// No closures were found
+	return false;
+}
+
+/***************************************************************
+* Function: Interpreter::releaseDeadVars()
+* Purpose : Release the variables dying at a statement
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Interpreter::releaseDeadVars(const Statement* pStmt, Environment* pEnv)
+{
+	// Find the variables dying at this statement, if any
+	DeadVarMap::const_iterator deadItr = s_pDeadVarInfo->deadVars.find(pStmt);
+	if (deadItr == s_pDeadVarInfo->deadVars.end())
+		return;
+	const DeadVarList& deadVars = deadItr->second;
+	
+	// Test if dead matrix buffers should be freed
+	bool freeBuffers = s_freeDeadBuffersVar.getBoolValue();
+	
+	// For each dying variable
+	for (DeadVarList::const_iterator varItr = deadVars.begin(); varItr != deadVars.end(); ++varItr)
+	{
+		// Get the object bound to the variable, if buffers may be freed
+		DataObject* pObject = freeBuffers? Environment::lookup(pEnv, *varItr):NULL;
+		
+		// Remove the binding from the local environment, if it was
+		// not bound locally, the object belongs to someone else
+		if (Environment::unbind(pEnv, *varItr) == false)
+			continue;
+		
+		// Increment the released variable count
+		PROF_INCR_COUNTER(Profiler::DEAD_VAR_RELEASE_COUNT);
+		
+		// Only large numerical matrices are worth freeing early
+		if (pObject == NULL || pObject->isMatrixObj() == false || pObject->getType() == DataObject::CELLARRAY)
+			continue;
+		BaseMatrixObj* pMatrix = (BaseMatrixObj*)pObject;
+		if (pMatrix->getNumElems() < FREE_BUFFER_MIN_ELEMS)
+			continue;
+		
+		// If another variable of this environment holds the same
+		// matrix, it is still in use, the elements cannot be freed
+		Environment::SymbolVec symbols = pEnv->getSymbols();
+		bool inUse = false;
+		for (Environment::SymbolVec::iterator symItr = symbols.begin(); symItr != symbols.end() && !inUse; ++symItr)
+			inUse = (Environment::lookup(pEnv, *symItr) == pObject);
+		if (inUse)
+			continue;
+		
+		// Free the matrix elements, if they are not shared
+		if (pMatrix->releaseElements())
+			PROF_INCR_COUNTER(Profiler::DEAD_BUFFER_FREE_COUNT);
 	}
 }
 
@@ -1144,29 +1520,41 @@ void Interpreter::evalExprStmt(const ExprStmt* pStmt, Environment* pEnv)
 ****************************************************************
 Revisions and bug fixes:
 */
-void Interpreter::evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv)
+Interpreter::ExecStatus Interpreter::evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv)
 {
 	// Get a reference to the condition expression
 	Expression* pCondExpr = pStmt->getCondition();
 
-	// Evaluate the condition expression
-	DataObject* pCondVal = evalExpression(pCondExpr, pEnv);
+	// Declare a variable for the boolean value of the condition
+	bool boolCondVal;
+
+	// If the unboxed scalar path is enabled
+	if (s_unboxedScalarsVar.getBoolValue() == true)
+	{
+		// Evaluate the condition without boxing a scalar result
+		boolCondVal = getScalarTruth(evalScalarExpr(pCondExpr, pEnv));
+	}
+	else
+	{
+		// Evaluate the condition expression
+		DataObject* pCondVal = evalExpression(pCondExpr, pEnv);
 
-	// Evaluate the condition value as a boolean
-	bool boolCondVal = getBoolValue(pCondVal);
+		// Evaluate the condition value as a boolean
+		boolCondVal = getBoolValue(pCondVal);
+	}
 
 	// If the condition evaluated to a true value
 	if (boolCondVal == true)
 	{
 		// Execute the if block
-		execSeqStmt(pStmt->getIfBlock(), pEnv);
+		return execSeqStmt(pStmt->getIfBlock(), pEnv);
 	}
 
 	// Otherwise, if the condition evaluated to false
 	else
 	{
 		// Execute the else block
-		execSeqStmt(pStmt->getElseBlock(), pEnv);
+		return execSeqStmt(pStmt->getElseBlock(), pEnv);
 	}
 }
 
@@ -1177,11 +1565,17 @@ void Interpreter::evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv)
 ****************************************************************
 Revisions and bug fixes:
 */
-void Interpreter::evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv)
+Interpreter::ExecStatus Interpreter::evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv)
 {
 	// Execute the loop initialization code
 	execSeqStmt(pLoopStmt->getInitSeq(), pEnv);
 
+	// Get the iteration count at which to switch to compiled code (0 if never)
+	size_t osrThreshold = JITCompiler::getOsrThreshold(pLoopStmt);
+	
+	// Initialize the iteration count
+	size_t itrCount = 0;
+
 	// Loop until the test condition is not met
 	for (;;)
 	{
@@ -1201,29 +1595,34 @@ void Interpreter::evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv)
 		if (boolResult == false)
 			break;
 
-		// Setup a try block to catch break and continue exceptions
-		try
-		{
-			// Execute the loop body code
-			execSeqStmt(pLoopStmt->getBodySeq(), pEnv);
-		}
+		// Execute the loop body code
+		ExecStatus status = execSeqStmt(pLoopStmt->getBodySeq(), pEnv);
 
-		// If a break exception occurs
-		catch (BreakExcept e)
-		{
-			// Break out of the loop
+		// If a break occurred, break out of the loop
+		if (status == EXEC_BREAK)
 			break;
-		}
 
-		// If a continue exception occurs
-		catch (ContinueExcept e)
-		{
-			// Do nothing, increment the loop normally
-		}
+		// If a return occurred, propagate it to the call point
+		if (status == EXEC_RETURN)
+			return EXEC_RETURN;
 
-		// Execute the index incrementation code
+		// Execute the index incrementation code, also on a continue
 		execSeqStmt(pLoopStmt->getIncrSeq(), pEnv);
+		
+		// If the loop just became hot, try to run the remaining iterations in compiled code
+		if (++itrCount == osrThreshold)
+		{
+			// If the rest of the loop was run in compiled code, stop
+			if (JITCompiler::osrEnterLoop(pLoopStmt, pEnv))
+				break;
+			
+			// Otherwise, try again after twice as many iterations
+			osrThreshold *= 2;
+		}
 	}
+	
+	// The loop completed normally
+	return EXEC_NORMAL;
 }
 
 /***************************************************************
@@ -1412,9 +1811,41 @@ Revisions and bug fixes:
 */
 DataObject* Interpreter::evalUnaryExpr(const UnaryOpExpr* pExpr, Environment* pEnv)
 {
+	// If the unboxed scalar path is enabled and handles this operator
+	if (s_unboxedScalarsVar.getBoolValue() == true && isUnboxedOp(pExpr))
+	{
+		// Evaluate the expression tree without boxing intermediate scalars,
+		// this also evaluates fused element-wise operations
+		return boxScalarValue(evalScalarExpr(pExpr, pEnv));
+	}
+
+	// If expression fusion is enabled and this is an element-wise operation
+	if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == true && FusedArrayOp::isFusableOp(pExpr))
+	{
+		// Get the fused operation for this expression tree
+		FusedArrayOp* pFusedOp = FusedArrayOp::getFusedOp(pExpr);
+		
+		// If the tree can be fused, evaluate it in a single pass
+		if (pFusedOp != NULL)
+			return pFusedOp->evaluate(pEnv);
+	}
+
 	// Evaluate the argument value
 	DataObject* pArgVal = evalExpression(pExpr->getOperand(), pEnv);
 
+	// Apply the operator to the value
+	return applyUnaryOp(pExpr, pArgVal);
+}
+
+/***************************************************************
+* Function: Interpreter::applyUnaryOp()
+* Purpose : Apply a unary operator to an evaluated operand
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::applyUnaryOp(const UnaryOpExpr* pExpr, DataObject* pArgVal)
+{
 	// Switch on the operator type
 	switch (pExpr->getOperator())
 	{
@@ -1578,6 +2009,25 @@ Revisions and bug fixes:
 */
 DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment* pEnv)
 {
+	// If the unboxed scalar path is enabled and handles this operator
+	if (s_unboxedScalarsVar.getBoolValue() == true && isUnboxedOp(pExpr))
+	{
+		// Evaluate the expression tree without boxing intermediate scalars,
+		// this also evaluates fused element-wise operations
+		return boxScalarValue(evalScalarExpr(pExpr, pEnv));
+	}
+
+	// If expression fusion is enabled and this is an element-wise operation
+	if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == true && FusedArrayOp::isFusableOp(pExpr))
+	{
+		// Get the fused operation for this expression tree
+		FusedArrayOp* pFusedOp = FusedArrayOp::getFusedOp(pExpr);
+		
+		// If the tree can be fused, evaluate it in a single pass
+		if (pFusedOp != NULL)
+			return pFusedOp->evaluate(pEnv);
+	}
+
 	// Get the left and right side expressions
 	Expression* pLeftExpr = pExpr->getLeftExpr();
 	Expression* pRightExpr = pExpr->getRightExpr();
@@ -1585,61 +2035,122 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 	// Switch on the operator type
 	switch (pExpr->getOperator())
 	{
-		// Binary addition
-		case BinaryOpExpr::PLUS:
+		// Logical OR
+		case BinaryOpExpr::OR:
 		{
-			// Evaluate the left and right expressions
+			// Evaluate the left expression
 			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
 
-			// Perform the addition
-			return arrayArithOp<AddOp>(pLeftVal, pRightVal);
-		}
-		break;
+			// If the left value evaluates to true
+			if (getBoolValue(pLeftVal) == true)
+			{
+				// Return a true value
+				return new LogicalArrayObj(1);
+			}
 
-		// Binary subtraction
-		case BinaryOpExpr::MINUS:
-		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
+			// Evaluate the right expression
 			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
 
-			// Perform the subtraction
-			return arrayArithOp<SubOp>(pLeftVal, pRightVal);
+			// If the right value evaluates to true
+			if (getBoolValue(pRightVal) == true)
+			{
+				// Return a true value
+				return new LogicalArrayObj(1);
+			}
+
+			// Return a false value
+			return new LogicalArrayObj(0);
 		}
 		break;
 
-		// Binary multiplication
-		case BinaryOpExpr::MULT:
+		// Logical AND
+		case BinaryOpExpr::AND:
 		{
-			// Evaluate the left and right expressions
+			// Evaluate the left expression
 			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
+
+			// If the left value evaluates to false
+			if (getBoolValue(pLeftVal) == false)
+			{
+				// Return a false value
+				return new LogicalArrayObj(0);
+			}
+
+			// Evaluate the right expression
 			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
 
-			// Perform the multiplication
-			return matrixMultOp(pLeftVal, pRightVal);
+			// If the right value evaluates to true
+			if (getBoolValue(pRightVal) == false)
+			{
+				// Return a true value
+				return new LogicalArrayObj(0);
+			}
+
+			// Return a true value
+			return new LogicalArrayObj(1);
 		}
 		break;
 
-		// Array multiplication
-		case BinaryOpExpr::ARRAY_MULT:
+		// All other operators
+		default:
 		{
 			// Evaluate the left and right expressions
 			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
 			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-			
-			// Perform the array multiplication
-			return arrayArithOp<MultOp>(pLeftVal, pRightVal);
+
+			// Apply the operator to the values
+			return applyBinaryOp(pExpr, pLeftVal, pRightVal);
 		}
-		break;
+	}
+}
 
-		// Right division
-		case BinaryOpExpr::DIV:
-		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-			
+/***************************************************************
+* Function: Interpreter::applyBinaryOp()
+* Purpose : Apply a binary operator to evaluated operands
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::applyBinaryOp(const BinaryOpExpr* pExpr, DataObject* pLeftVal, DataObject* pRightVal)
+{
+	// Switch on the operator type
+	switch (pExpr->getOperator())
+	{
+		// Binary addition
+		case BinaryOpExpr::PLUS:
+		{
+			// Perform the addition
+			return arrayArithOp<AddOp>(pLeftVal, pRightVal);
+		}
+		break;
+
+		// Binary subtraction
+		case BinaryOpExpr::MINUS:
+		{
+			// Perform the subtraction
+			return arrayArithOp<SubOp>(pLeftVal, pRightVal);
+		}
+		break;
+
+		// Binary multiplication
+		case BinaryOpExpr::MULT:
+		{
+			// Perform the multiplication
+			return matrixMultOp(pLeftVal, pRightVal);
+		}
+		break;
+
+		// Array multiplication
+		case BinaryOpExpr::ARRAY_MULT:
+		{
+			// Perform the array multiplication
+			return arrayArithOp<MultOp>(pLeftVal, pRightVal);
+		}
+		break;
+
+		// Right division
+		case BinaryOpExpr::DIV:
+		{
 			// Perform the right division operation
 			return matrixRightDivOp(pLeftVal, pRightVal);
 		}
@@ -1648,10 +2159,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Array division
 		case BinaryOpExpr::ARRAY_DIV:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform the array division
 			return arrayArithOp<DivOp>(pLeftVal, pRightVal);
 		}
@@ -1660,10 +2167,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Left division
 		case BinaryOpExpr::LEFT_DIV:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// If both values are matrices
 			if (pLeftVal->getType() == DataObject::MATRIX_F64 && pRightVal->getType() == DataObject::MATRIX_F64)
 			{
@@ -1690,10 +2193,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Binary power
 		case BinaryOpExpr::POWER:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// If either of the values are 128-bit complex matrices
 			if (pLeftVal->getType() == DataObject::MATRIX_C128 || pRightVal->getType() == DataObject::MATRIX_C128)
 			{
@@ -1741,10 +2240,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Array power
 		case BinaryOpExpr::ARRAY_POWER:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform the array power operation
 			return arrayArithOp<PowOp>(pLeftVal, pRightVal);
 		}
@@ -1753,10 +2248,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Equality comparison
 		case BinaryOpExpr::EQUAL:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform an equality comparison between the objects
 			return matrixLogicOp<EqualOp>(pLeftVal, pRightVal);
 		}
@@ -1765,10 +2256,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Inequality comparison
 		case BinaryOpExpr::NOT_EQUAL:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform an inequality comparison between the objects
 			return matrixLogicOp<NotEqualOp>(pLeftVal, pRightVal);
 		}
@@ -1777,10 +2264,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Less-than comparison
 		case BinaryOpExpr::LESS_THAN:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform a less-than comparison between the objects
 			return matrixLogicOp<LessThanOp>(pLeftVal, pRightVal);
 		}
@@ -1789,10 +2272,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Less-than or equal comparison
 		case BinaryOpExpr::LESS_THAN_EQ:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform a less-than or equal comparison between the objects
 			return matrixLogicOp<LessThanEqOp>(pLeftVal, pRightVal);
 		}
@@ -1801,10 +2280,6 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Greater-than comparison
 		case BinaryOpExpr::GREATER_THAN:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform a greater-than comparison between the objects
 			return matrixLogicOp<GreaterThanOp>(pLeftVal, pRightVal);
 		}
@@ -1813,90 +2288,22 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 		// Greater-than or equal comparison
 		case BinaryOpExpr::GREATER_THAN_EQ:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform a greater-than or equal comparison between the objects
 			return matrixLogicOp<GreaterThanEqOp>(pLeftVal, pRightVal);
 		}
 		break;
 
-		// Logical OR
-		case BinaryOpExpr::OR:
-		{
-			// Evaluate the left expression
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-
-			// If the left value evaluates to true
-			if (getBoolValue(pLeftVal) == true)
-			{
-				// Return a true value
-				return new LogicalArrayObj(1);
-			}
-
-			// Evaluate the right expression
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
-			// If the right value evaluates to true
-			if (getBoolValue(pRightVal) == true)
-			{
-				// Return a true value
-				return new LogicalArrayObj(1);
-			}
-
-			// Return a false value
-			return new LogicalArrayObj(0);
-		}
-		break;
-
 		// Array OR
 		case BinaryOpExpr::ARRAY_OR:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-			
 			// Perform the array OR operation
 			return matrixLogicOp<OrOp>(pLeftVal, pRightVal);
 		}
 		break;
 
-		// Logical AND
-		case BinaryOpExpr::AND:
-		{
-			// Evaluate the left expression
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-
-			// If the left value evaluates to false
-			if (getBoolValue(pLeftVal) == false)
-			{
-				// Return a false value
-				return new LogicalArrayObj(0);
-			}
-
-			// Evaluate the right expression
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
-			// If the right value evaluates to true
-			if (getBoolValue(pRightVal) == false)
-			{
-				// Return a true value
-				return new LogicalArrayObj(0);
-			}
-
-			// Return a true value
-			return new LogicalArrayObj(1);
-		}
-		break;
-
 		// Array AND
 		case BinaryOpExpr::ARRAY_AND:
 		{
-			// Evaluate the left and right expressions
-			DataObject* pLeftVal = evalExpression(pLeftExpr, pEnv);
-			DataObject* pRightVal = evalExpression(pRightExpr, pEnv);
-
 			// Perform the array AND operation
 			return matrixLogicOp<AndOp>(pLeftVal, pRightVal);
 		}
@@ -1915,6 +2322,403 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 	throw RunError("unsupported operand types in binary expression", pExpr);
 }
 
+
+/***************************************************************
+* Function: Interpreter::isUnboxedOp()
+* Purpose : Test if an operator is handled by the scalar path
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::isUnboxedOp(const Expression* pExpr)
+{
+	// If this is a binary expression
+	if (pExpr->getExprType() == Expression::BINARY_OP)
+	{
+		// Switch on the operator type
+		switch (((BinaryOpExpr*)pExpr)->getOperator())
+		{
+			// Arithmetic, comparison and logical operators
+			case BinaryOpExpr::PLUS:
+			case BinaryOpExpr::MINUS:
+			case BinaryOpExpr::MULT:
+			case BinaryOpExpr::ARRAY_MULT:
+			case BinaryOpExpr::DIV:
+			case BinaryOpExpr::ARRAY_DIV:
+			case BinaryOpExpr::POWER:
+			case BinaryOpExpr::EQUAL:
+			case BinaryOpExpr::NOT_EQUAL:
+			case BinaryOpExpr::LESS_THAN:
+			case BinaryOpExpr::LESS_THAN_EQ:
+			case BinaryOpExpr::GREATER_THAN:
+			case BinaryOpExpr::GREATER_THAN_EQ:
+			case BinaryOpExpr::OR:
+			case BinaryOpExpr::ARRAY_OR:
+			case BinaryOpExpr::AND:
+			case BinaryOpExpr::ARRAY_AND:
+			return true;
+			
+			// Other operators are always evaluated on boxed values
+			default:
+			return false;
+		}
+	}
+	
+	// If this is a unary expression
+	if (pExpr->getExprType() == Expression::UNARY_OP)
+	{
+		// Get the operator type
+		UnaryOpExpr::Operator op = ((UnaryOpExpr*)pExpr)->getOperator();
+		
+		// Transpositions are always evaluated on boxed values
+		return (op == UnaryOpExpr::PLUS || op == UnaryOpExpr::MINUS || op == UnaryOpExpr::NOT);
+	}
+	
+	// Other expressions are not operators
+	return false;
+}
+
+/***************************************************************
+* Function: Interpreter::evalScalarExpr()
+* Purpose : Evaluate an expression, keeping scalars unboxed
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+Interpreter::ScalarValue Interpreter::evalScalarExpr(const Expression* pExpr, Environment* pEnv)
+{
+	// Declare a value for the result
+	ScalarValue result;
+	result.pObject = NULL;
+	
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Integer constant expression
+		case Expression::INT_CONST:
+		{
+			// Produce the constant value
+			result.kind = ScalarValue::FLOAT;
+			result.value = ((IntConstExpr*)pExpr)->getValue();
+			return result;
+		}
+		break;
+		
+		// Floating-point constant expression
+		case Expression::FP_CONST:
+		{
+			// Produce the constant value
+			result.kind = ScalarValue::FLOAT;
+			result.value = ((FPConstExpr*)pExpr)->getValue();
+			return result;
+		}
+		break;
+		
+		// Symbol expression
+		case Expression::SYMBOL:
+		{
+			// Lookup the symbol
+			DataObject* pObject = Environment::lookup(pEnv, (SymbolExpr*)pExpr);
+			
+			// If the symbol is bound to a floating-point scalar
+			if (pObject != NULL && pObject->getType() == DataObject::MATRIX_F64 && ((MatrixF64Obj*)pObject)->isScalar())
+			{
+				// Read the scalar, keeping the object to avoid boxing it again
+				result.kind = ScalarValue::FLOAT;
+				result.value = ((MatrixF64Obj*)pObject)->getScalar();
+				result.pObject = pObject;
+				return result;
+			}
+			
+			// If the symbol is bound to a logical scalar
+			if (pObject != NULL && pObject->getType() == DataObject::LOGICALARRAY && ((LogicalArrayObj*)pObject)->isScalar())
+			{
+				// Read the scalar, keeping the object to avoid boxing it again
+				result.kind = ScalarValue::LOGICAL;
+				result.value = ((LogicalArrayObj*)pObject)->getScalar()? 1:0;
+				result.pObject = pObject;
+				return result;
+			}
+		}
+		break;
+		
+		// Binary operator expression
+		case Expression::BINARY_OP:
+		{
+			// If the operator is not handled by the scalar path, evaluate it boxed
+			if (isUnboxedOp(pExpr) == false)
+				break;
+			
+			// If expression fusion is enabled and this is an element-wise operation
+			if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == true && FusedArrayOp::isFusableOp(pExpr))
+			{
+				// Get the fused operation for this expression tree
+				FusedArrayOp* pFusedOp = FusedArrayOp::getFusedOp(pExpr);
+				
+				// If the tree can be fused, evaluate it in a single pass
+				if (pFusedOp != NULL)
+					return evalFusedScalarOp(pFusedOp, pEnv);
+			}
+			
+			// Get a typed pointer to the expression
+			BinaryOpExpr* pBinExpr = (BinaryOpExpr*)pExpr;
+			BinaryOpExpr::Operator op = pBinExpr->getOperator();
+			
+			// If this is a short-circuit logical operator
+			if (op == BinaryOpExpr::OR || op == BinaryOpExpr::AND)
+			{
+				// The result is a logical value
+				result.kind = ScalarValue::LOGICAL;
+				
+				// Evaluate the left expression
+				bool leftVal = getScalarTruth(evalScalarExpr(pBinExpr->getLeftExpr(), pEnv));
+				
+				// If the left value determines the result, do not evaluate the right expression
+				if (leftVal == (op == BinaryOpExpr::OR))
+				{
+					result.value = leftVal? 1:0;
+					return result;
+				}
+				
+				// Otherwise, the result is the value of the right expression
+				result.value = getScalarTruth(evalScalarExpr(pBinExpr->getRightExpr(), pEnv))? 1:0;
+				return result;
+			}
+			
+			// Evaluate the left and right expressions
+			ScalarValue leftVal = evalScalarExpr(pBinExpr->getLeftExpr(), pEnv);
+			ScalarValue rightVal = evalScalarExpr(pBinExpr->getRightExpr(), pEnv);
+			
+			// If either value is not a scalar, apply the operator to boxed values
+			if (leftVal.kind == ScalarValue::BOXED || rightVal.kind == ScalarValue::BOXED)
+			{
+				result.kind = ScalarValue::BOXED;
+				result.pObject = applyBinaryOp(pBinExpr, boxScalarValue(leftVal), boxScalarValue(rightVal));
+				return result;
+			}
+			
+			// Get the scalar operand values
+			float64 lFloat = leftVal.value;
+			float64 rFloat = rightVal.value;
+			
+			// Arithmetic operators produce floating-point values
+			result.kind = ScalarValue::FLOAT;
+			
+			// Switch on the operator type
+			switch (op)
+			{
+				case BinaryOpExpr::PLUS:			result.value = AddOp<float64>::op(lFloat, rFloat); break;
+				case BinaryOpExpr::MINUS:			result.value = SubOp<float64>::op(lFloat, rFloat); break;
+				case BinaryOpExpr::MULT:
+				case BinaryOpExpr::ARRAY_MULT:		result.value = MultOp<float64>::op(lFloat, rFloat); break;
+				case BinaryOpExpr::DIV:
+				case BinaryOpExpr::ARRAY_DIV:		result.value = DivOp<float64>::op(lFloat, rFloat); break;
+				case BinaryOpExpr::POWER:			result.value = pow(lFloat, rFloat); break;
+				
+				// Comparison and logical operators produce logical values
+				default:
+				{
+					// The result is a logical value
+					result.kind = ScalarValue::LOGICAL;
+					
+					// Switch on the operator type
+					bool boolVal = false;
+					switch (op)
+					{
+						case BinaryOpExpr::EQUAL:			boolVal = EqualOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::NOT_EQUAL:		boolVal = NotEqualOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::LESS_THAN:		boolVal = LessThanOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::LESS_THAN_EQ:	boolVal = LessThanEqOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::GREATER_THAN:	boolVal = GreaterThanOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::GREATER_THAN_EQ:	boolVal = GreaterThanEqOp<float64>::op(lFloat, rFloat); break;
+						case BinaryOpExpr::ARRAY_OR:		boolVal = (lFloat != 0) || (rFloat != 0); break;
+						case BinaryOpExpr::ARRAY_AND:		boolVal = (lFloat != 0) && (rFloat != 0); break;
+						default: assert (false);
+					}
+					
+					// Store the logical value
+					result.value = boolVal? 1:0;
+				}
+			}
+			
+			// Return the unboxed result
+			return result;
+		}
+		break;
+		
+		// Unary operator expression
+		case Expression::UNARY_OP:
+		{
+			// If the operator is not handled by the scalar path, evaluate it boxed
+			if (isUnboxedOp(pExpr) == false)
+				break;
+			
+			// If expression fusion is enabled and this is an element-wise operation
+			if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == true && FusedArrayOp::isFusableOp(pExpr))
+			{
+				// Get the fused operation for this expression tree
+				FusedArrayOp* pFusedOp = FusedArrayOp::getFusedOp(pExpr);
+				
+				// If the tree can be fused, evaluate it in a single pass
+				if (pFusedOp != NULL)
+					return evalFusedScalarOp(pFusedOp, pEnv);
+			}
+			
+			// Get a typed pointer to the expression
+			UnaryOpExpr* pUnExpr = (UnaryOpExpr*)pExpr;
+			
+			// Evaluate the operand
+			ScalarValue argVal = evalScalarExpr(pUnExpr->getOperand(), pEnv);
+			
+			// If the value is not a scalar, apply the operator to the boxed value
+			if (argVal.kind == ScalarValue::BOXED)
+			{
+				result.kind = ScalarValue::BOXED;
+				result.pObject = applyUnaryOp(pUnExpr, argVal.pObject);
+				return result;
+			}
+			
+			// Switch on the operator type
+			switch (pUnExpr->getOperator())
+			{
+				// Unary plus returns the operand unaltered
+				case UnaryOpExpr::PLUS:
+				{
+					return argVal;
+				}
+				break;
+				
+				// Arithmetic negation produces a floating-point value
+				case UnaryOpExpr::MINUS:
+				{
+					result.kind = ScalarValue::FLOAT;
+					result.value = -argVal.value;
+				}
+				break;
+				
+				// Logical negation produces a logical value
+				case UnaryOpExpr::NOT:
+				{
+					result.kind = ScalarValue::LOGICAL;
+					result.value = (argVal.value == 0)? 1:0;
+				}
+				break;
+				
+				default: assert (false);
+			}
+			
+			// Return the unboxed result
+			return result;
+		}
+		break;
+		
+		// Other expression types are evaluated boxed
+		default:
+		break;
+	}
+	
+	// Evaluate the expression as a boxed object
+	result.kind = ScalarValue::BOXED;
+	result.pObject = evalExpression(pExpr, pEnv);
+	return result;
+}
+
+/***************************************************************
+* Function: Interpreter::evalFusedScalarOp()
+* Purpose : Evaluate a fused operation, keeping scalars unboxed
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+Interpreter::ScalarValue Interpreter::evalFusedScalarOp(const FusedArrayOp* pFusedOp, Environment* pEnv)
+{
+	// Get the leaf expressions
+	const Expression::ExprVector& leaves = pFusedOp->getLeaves();
+	size_t numLeaves = leaves.size();
+	
+	// Keep the leaf values on the stack for small trees, where the
+	// collector can see the boxed objects they reference
+	ScalarValue localVals[8];
+	float64 localFloats[8];
+	std::vector<ScalarValue, gc_allocator<ScalarValue> > heapVals;
+	std::vector<float64> heapFloats;
+	ScalarValue* pLeafVals = localVals;
+	float64* pLeafFloats = localFloats;
+	if (numLeaves > 8)
+	{
+		heapVals.resize(numLeaves);
+		heapFloats.resize(numLeaves);
+		pLeafVals = &heapVals[0];
+		pLeafFloats = &heapFloats[0];
+	}
+	
+	// Evaluate the leaf expressions in order
+	bool allScalars = true;
+	for (size_t i = 0; i < numLeaves; ++i)
+	{
+		pLeafVals[i] = evalScalarExpr(leaves[i], pEnv);
+		pLeafFloats[i] = pLeafVals[i].value;
+		allScalars = allScalars && (pLeafVals[i].kind != ScalarValue::BOXED);
+	}
+	
+	// Declare a value for the result
+	ScalarValue result;
+	
+	// If all leaves are scalars, evaluate the operation unboxed
+	if (allScalars)
+	{
+		result.kind = ScalarValue::FLOAT;
+		result.value = pFusedOp->evalScalar(pLeafFloats);
+		result.pObject = NULL;
+		return result;
+	}
+	
+	// Otherwise, box the leaf values and evaluate the operation on arrays
+	ArrayObj* pLeafObjs = new ArrayObj(numLeaves);
+	for (size_t i = 0; i < numLeaves; ++i)
+		ArrayObj::addObject(pLeafObjs, boxScalarValue(pLeafVals[i]));
+	result.kind = ScalarValue::BOXED;
+	result.pObject = FusedArrayOp::evalLeaves(pFusedOp, pLeafObjs);
+	return result;
+}
+
+/***************************************************************
+* Function: Interpreter::boxScalarValue()
+* Purpose : Box a scalar value into a data object
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::boxScalarValue(const ScalarValue& value)
+{
+	// If the value already has an object, return it
+	if (value.pObject != NULL)
+		return value.pObject;
+	
+	// Create a scalar object of the right type
+	if (value.kind == ScalarValue::LOGICAL)
+		return new LogicalArrayObj(value.value != 0);
+	else
+		return new MatrixF64Obj(value.value);
+}
+
+/***************************************************************
+* Function: Interpreter::getScalarTruth()
+* Purpose : Evaluate a scalar value as a boolean
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::getScalarTruth(const ScalarValue& value)
+{
+	// If the value is boxed, test the object
+	if (value.kind == ScalarValue::BOXED)
+		return getBoolValue(value.pObject);
+	
+	// Otherwise, any nonzero scalar is true
+	return value.value != 0;
+}
+
 /***************************************************************
 * Function: Interpreter::evalRangeExpr()
 * Purpose : Evaluate a range expression
@@ -2254,8 +3058,8 @@ DataObject* Interpreter::evalParamExpr(const ParamExpr* pExpr, Environment* pEnv
 			}
 		}
 		
-		// Call the function
-		ArrayObj* pResult = callFunction(pFunction, pArguments, nargout);
+		// Call the function, using this expression as call site
+		ArrayObj* pResult = callFunction(pFunction, pArguments, nargout, pExpr);
 
 		// Return the result
 		return pResult;
@@ -2463,6 +3267,93 @@ DataObject* Interpreter::evalLambdaExpr(const LambdaExpr* pExpr, Environment* pE
 	// Set the function's local environment to a copy of the current environment
 	ProgFunction::setLocalEnv(pFunction, pEnv->copy());
 
+	// Get the symbols read by the body that are not input parameters
+	Expression::SymbolSet freeSyms = pBodyExpr->getSymbolUses();
+	for (ProgFunction::ParamVector::iterator itr = inParams.begin(); itr != inParams.end(); ++itr)
+		freeSyms.erase(*itr);
+	
+	// Declare vectors for the captured variables and their values
+	ProgFunction::ParamVector capturedSyms;
+	ArrayObj* pCapturedVals = new ArrayObj(freeSyms.size());
+	
+	// Declare a vector for the bindings of the other free symbols
+	BindingVector freeBindings;
+	
+	// For each free symbol
+	for (Expression::SymbolSet::iterator itr = freeSyms.begin(); itr != freeSyms.end(); ++itr)
+	{
+		// Get a pointer to the symbol
+		SymbolExpr* pSymbol = *itr;
+		
+		// If this is the "nargin" or "nargout" symbol, the code cannot be shared
+		if (pSymbol == s_pNarginSym || pSymbol == s_pNargoutSym)
+			return new FnHandleObj(pFunction);
+		
+		// Lookup the symbol in the captured environment
+		DataObject* pValue = Environment::lookup(pEnv, pSymbol);
+		
+		// If the symbol is unbound or bound to a function, it is not captured,
+		// the code can only be shared by closures where it resolves the same way
+		if (pValue == NULL || pValue->getType() == DataObject::FUNCTION)
+		{
+			freeBindings.push_back(pValue);
+			continue;
+		}
+		
+		// Capture the symbol and a copy of its value
+		capturedSyms.push_back(pSymbol);
+		ArrayObj::addObject(pCapturedVals, pValue->copy());
+	}
+	
+	// Get the shared code functions for this lambda expression
+	LambdaCodeList& codeList = s_lambdaCodeMap[pExpr];
+	
+	// For each shared code function
+	for (LambdaCodeList::iterator itr = codeList.begin(); itr != codeList.end(); ++itr)
+	{
+		// Get the captured variables of the code function
+		const ProgFunction::ParamVector& codeParams = itr->pCodeFunc->getInParams();
+		
+		// If this closure captures the same variables and its other free
+		// symbols have the same bindings, share the code
+		if (codeParams.size() == inParams.size() + capturedSyms.size() &&
+			std::equal(capturedSyms.begin(), capturedSyms.end(), codeParams.begin() + inParams.size()) &&
+			itr->freeBindings == freeBindings)
+		{
+			pFunction->setClosureCode(itr->pCodeFunc, pCapturedVals);
+			return new FnHandleObj(pFunction);
+		}
+	}
+	
+	// If there are too many code functions for this expression, do not share the code
+	if (codeList.size() >= MAX_LAMBDA_CODES)
+		return new FnHandleObj(pFunction);
+	
+	// The code function takes the captured variables as extra inputs
+	ProgFunction::ParamVector codeParams = inParams;
+	codeParams.insert(codeParams.end(), capturedSyms.begin(), capturedSyms.end());
+	
+	// Create the code function from a copy of the closure body
+	LambdaCode lambdaCode;
+	lambdaCode.pCodeFunc = new ProgFunction(
+		"",
+		codeParams,
+		outParams,
+		ProgFunction::FuncVector(),
+		(StmtSequence*)pStmtSeq->copy(),
+		false,
+		false
+	);
+	lambdaCode.freeBindings = freeBindings;
+	
+	// Resolve the other free symbols in this closure's environment, this is
+	// set once, closures sharing the code resolve them the same way
+	ProgFunction::setLocalEnv(lambdaCode.pCodeFunc, ProgFunction::getLocalEnv(pFunction));
+	
+	// Add the code function to the list and share it with this closure
+	codeList.push_back(lambdaCode);
+	pFunction->setClosureCode(lambdaCode.pCodeFunc, pCapturedVals);
+
 	// Return a handle to the new function object
 	return new FnHandleObj(pFunction);
 }
@@ -2486,7 +3377,8 @@ DataObject* Interpreter::evalSymbolExpr(const SymbolExpr* pExpr, Environment* pE
 		Function* pFunction = (Function*)pResult;
 
 		// Call the function with no arguments to obtain the desired result
-		// Note: this is done to handle calls without explicit parenthesizing
+		// Note: this is done to handle calls without explicit parenthesizing,
+		//       symbols are shared between functions and have no call site cache
 		pResult = callFunction(pFunction, new ArrayObj(), nargout);
 	}
 	
@@ -2797,4 +3689,10 @@ void Interpreter::clearProgFuncs()
 			Environment::unbind(&s_globalEnv, pSymbol);
 		}
 	}
+	
+	// Drop the shared closure code of the removed functions
+	s_lambdaCodeMap.clear();
+	
+	// Drop the dead variable info of the removed functions
+	s_deadVarInfoMap.clear();
 }
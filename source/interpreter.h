@@ -50,6 +50,10 @@
 #include "lambdaexpr.h"
 #include "typeinfer.h"
 #include "analysis_typeinfer.h"
+#include "analysis_livevars.h"
+
+// Forward declarations
+class FusedArrayOp;
 
 /***************************************************************
 * Class   : Interpreter
@@ -62,6 +66,36 @@ class Interpreter
 {
 public:
 
+	// Enumerate statement completion statuses
+	enum ExecStatus
+	{
+		EXEC_NORMAL,
+		EXEC_BREAK,
+		EXEC_CONTINUE,
+		EXEC_RETURN
+	};
+
+	// Scalar value produced by the unboxed scalar path
+	struct ScalarValue
+	{
+		// Enumerate value kinds
+		enum Kind
+		{
+			BOXED,
+			FLOAT,
+			LOGICAL
+		};
+		
+		// Kind of value
+		Kind kind;
+		
+		// Unboxed value, logical values are stored as 0 or 1
+		float64 value;
+		
+		// Boxed object, also kept for scalars read from variables
+		DataObject* pObject;
+	};
+
 	// Method to initialize the interpreter
 	static void initialize();
 
@@ -72,13 +106,13 @@ public:
 	static ArrayObj* callByName(const std::string& funcName, ArrayObj* pArguments = new ArrayObj());
 
 	// Method to perform a function call
-	static ArrayObj* callFunction(Function* pFunction, ArrayObj* pArguments, size_t nargout = 0);
+	static ArrayObj* callFunction(Function* pFunction, ArrayObj* pArguments, size_t nargout = 0, const ParamExpr* pCallSite = NULL);
 
 	// Method to evaluate a statement
-	static void execStatement(const Statement* pStmt, Environment* pEnv);
+	static ExecStatus execStatement(const Statement* pStmt, Environment* pEnv);
 
 	// Method to evaluate a sequence statement
-	static void execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv);
+	static ExecStatus execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv);
 
 	// Method to evaluate an assignment statement
 	static void evalAssignStmt(const AssignStmt* pStmt, Environment* pEnv);
@@ -93,10 +127,10 @@ public:
 	static void evalExprStmt(const ExprStmt* pStmt, Environment* pEnv);
 
 	// Method to evaluate an if-else statement
-	static void evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv);
+	static ExecStatus evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv);
 
 	// Method to evaluate a loop statement
-	static void evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv);
+	static ExecStatus evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv);
 
 	// Method to evaluate an expression
 	static DataObject* evalExpression(const Expression* pExpr, Environment* pEnv);
@@ -107,6 +141,16 @@ public:
 	// Method to evaluate a binary operator expression
 	static DataObject* evalBinaryExpr(const BinaryOpExpr* pExpr, Environment* pEnv);
 
+	// Methods to apply operators to evaluated operands
+	static DataObject* applyUnaryOp(const UnaryOpExpr* pExpr, DataObject* pArgVal);
+	static DataObject* applyBinaryOp(const BinaryOpExpr* pExpr, DataObject* pLeftVal, DataObject* pRightVal);
+
+	// Method to evaluate an expression, keeping scalar values unboxed
+	static ScalarValue evalScalarExpr(const Expression* pExpr, Environment* pEnv);
+
+	// Method to box a scalar value into a data object
+	static DataObject* boxScalarValue(const ScalarValue& value);
+
 	// Method to evaluate a range expression
 	static DataObject* evalRangeExpr(const RangeExpr* pExpr, Environment* pEnv, bool expand = true);
 
@@ -170,8 +214,54 @@ public:
 
 	// Config variable to enable/disable type inference profiling
 	static ConfigVar s_profTypeInfer;
+
+	// Config variable to enable/disable the unboxed scalar path
+	static ConfigVar s_unboxedScalarsVar;
+	
+	// Config variable to drop variable bindings after their last use
+	static ConfigVar s_releaseDeadVarsVar;
+	
+	// Config variable to free the buffers of dead, unshared matrices
+	static ConfigVar s_freeDeadBuffersVar;
+	
+	// Minimum element count of the matrix buffers freed early
+	static const size_t FREE_BUFFER_MIN_ELEMS = 8192;
 	
 private:
+	
+	// Dead variable list and map type definitions
+	typedef std::vector<SymbolExpr*, gc_allocator<SymbolExpr*> > DeadVarList;
+	typedef __gnu_cxx::hash_map<const Statement*, DeadVarList, IntHashFunc<const Statement*>, __gnu_cxx::equal_to<const Statement*>, gc_allocator<DeadVarList> > DeadVarMap;
+	
+	// Variables dying at each statement of a function body
+	struct DeadVarInfo : public gc
+	{
+		// Variables to release after each statement
+		DeadVarMap deadVars;
+	};
+	
+	// Method to get the dead variable info for a function
+	static const DeadVarInfo* getDeadVarInfo(ProgFunction* pFunction);
+	
+	// Method to find the variables dying at each statement of a sequence
+	static void findDeadVars(const StmtSequence* pSeqStmt, const LiveVarMap& liveVars, DeadVarMap& deadVars);
+	
+	// Methods to test if code may capture its environment
+	static bool hasClosures(const StmtSequence* pSeqStmt);
+	static bool hasClosures(const Statement* pStmt);
+	static bool hasClosures(const Expression* pExpr);
+	
+	// Method to release the variables dying at a statement
+	static void releaseDeadVars(const Statement* pStmt, Environment* pEnv);
+
+	// Method to test if an operator is handled by the unboxed scalar path
+	static bool isUnboxedOp(const Expression* pExpr);
+
+	// Method to evaluate a fused operation, keeping scalar values unboxed
+	static ScalarValue evalFusedScalarOp(const FusedArrayOp* pFusedOp, Environment* pEnv);
+
+	// Method to evaluate a scalar value as a boolean
+	static bool getScalarTruth(const ScalarValue& value);
 
 	// Global execution environment
 	static Environment s_globalEnv;
@@ -204,6 +294,34 @@ private:
 	// Set used for type inference output
 	typedef std::set<const Statement*> ViewedStmtSet;
 	static ViewedStmtSet s_viewedStmtSet;
+	
+	// Binding vector type definition
+	typedef std::vector<DataObject*, gc_allocator<DataObject*> > BindingVector;
+	
+	// Shared closure code structure
+	struct LambdaCode
+	{
+		// Shared code function
+		ProgFunction* pCodeFunc;
+		
+		// Objects bound to the free symbols not captured (null if unbound)
+		BindingVector freeBindings;
+	};
+	
+	// Maximum number of shared code functions per lambda expression
+	static const size_t MAX_LAMBDA_CODES = 8;
+	
+	// Map of shared closure code functions, per lambda expression
+	typedef std::vector<LambdaCode, gc_allocator<LambdaCode> > LambdaCodeList;
+	typedef __gnu_cxx::hash_map<const LambdaExpr*, LambdaCodeList, IntHashFunc<const LambdaExpr*>, __gnu_cxx::equal_to<const LambdaExpr*>, gc_allocator<LambdaCodeList> > LambdaCodeMap;
+	static LambdaCodeMap s_lambdaCodeMap;
+	
+	// Map of dead variable info, per function body
+	typedef __gnu_cxx::hash_map<const StmtSequence*, DeadVarInfo*, IntHashFunc<const StmtSequence*>, __gnu_cxx::equal_to<const StmtSequence*>, gc_allocator<DeadVarInfo*> > DeadVarInfoMap;
+	static DeadVarInfoMap s_deadVarInfoMap;
+	
+	// Dead variable info of the function being interpreted (null if none)
+	static const DeadVarInfo* s_pDeadVarInfo;
 };
 
 #endif // #ifndef INTERPRETER_H_
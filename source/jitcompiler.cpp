@@ -17,9 +17,18 @@
 //                                                                             //
 // =========================================================================== //
 
+// The compilation thread registers itself with the collector explicitly
+#define GC_THREADS
+#define GC_NO_THREAD_REDIRECTS
+
 // Header files
+#include <gc.h>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <sstream>
+#include <algorithm>
 #include <llvm/Module.h>
 #include <llvm/PassManager.h>
 #include <llvm/CallingConv.h>
@@ -31,11 +40,17 @@
 #include <llvm/DataLayout.h>
 #include <llvm/Target/TargetOptions.h>
 #include <llvm/Transforms/Scalar.h>
+#include <llvm/Transforms/Vectorize.h>
 #include <llvm/Transforms/IPO.h>
 #include <llvm/Assembly/PrintModulePass.h>
 #include <llvm/ExecutionEngine/GenericValue.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MDBuilder.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Bitcode/ReaderWriter.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Linker.h>
 
 
 #include "jitcompiler.h"
@@ -47,6 +62,8 @@
 #include "matrixops.h"
 #include "transform_logic.h"
 #include "transform_split.h"
+#include "codecache.h"
+#include "parsecache.h"
 
 // Config variable to enable/disable the JIT compiler
 ConfigVar JITCompiler::s_jitEnableVar("jit_enable", ConfigVar::BOOL, "false");
@@ -57,12 +74,27 @@ ConfigVar JITCompiler::s_jitCopyEnableVar("jit_copy_enable", ConfigVar::BOOL, "f
 // Config variable to enable/disable on-stack replacement capability
 ConfigVar JITCompiler::s_jitOsrEnableVar("jit_osr_enable", ConfigVar::BOOL, "false");
 ConfigVar JITCompiler::s_jitOsrStrategyVar("jit_osr_strategy", ConfigVar::STRING, "any");
+ConfigVar JITCompiler::s_jitOsrThresholdVar("jit_osr_threshold", ConfigVar::INT, "1000");
+
+// Config variable for the number of interpreted calls before compiling a function
+ConfigVar JITCompiler::s_jitHotThresholdVar("jit_hot_threshold", ConfigVar::INT, "0", 0);
+
+// Config variable to enable/disable code generation in a background thread
+ConfigVar JITCompiler::s_jitBackgroundVar("jit_background", ConfigVar::BOOL, "false");
+
+// Config variable for the optimization level of the generated code
+ConfigVar JITCompiler::s_jitOptLevelVar("jit_opt_level", ConfigVar::INT, "1", 0, 3);
+
+// Config variables for ahead-of-time compilation into the code cache
+ConfigVar JITCompiler::s_aotCompileVar("aot_compile", ConfigVar::BOOL, "false");
+ConfigVar JITCompiler::s_aotArgTypesVar("aot_arg_types", ConfigVar::STRING, "");
 
 // Config variables to enable/disable specific JIT optimizations
 ConfigVar JITCompiler::s_jitUseArrayOpts("jit_use_array_opts", ConfigVar::BOOL, "true");
 ConfigVar JITCompiler::s_jitUseBinOpOpts("jit_use_binop_opts", ConfigVar::BOOL, "true");
 ConfigVar JITCompiler::s_jitUseLibOpts("jit_use_libfunc_opts", ConfigVar::BOOL, "true");
 ConfigVar JITCompiler::s_jitUseDirectCalls("jit_use_direct_calls", ConfigVar::BOOL, "true");
+ConfigVar JITCompiler::s_jitUseCallCaches("jit_use_call_caches", ConfigVar::BOOL, "true");
 
 // Config variables to disable matrix read/write bounds checking
 ConfigVar JITCompiler::s_jitNoReadBoundChecks("jit_no_read_bound_checks", ConfigVar::BOOL, "false");
@@ -99,6 +131,24 @@ JITCompiler::LibFuncMap JITCompiler::s_libFuncMap;
 // Map of program functions to function objects
 JITCompiler::FunctionMap JITCompiler::s_functionMap;
 
+// Map of interpreted loops to their OSR loop functions
+JITCompiler::OsrLoopMap JITCompiler::s_osrLoopMap;
+
+// Map of function versions to their interpreted call counts
+JITCompiler::HotCountMap JITCompiler::s_hotCountMap;
+
+// Background compilation state
+std::recursive_mutex JITCompiler::s_compMutex;
+std::condition_variable_any JITCompiler::s_compCond;
+JITCompiler::CompQueue JITCompiler::s_compQueue;
+std::thread* JITCompiler::s_pCompThread = NULL;
+bool JITCompiler::s_stopCompThread = false;
+
+// Code cache record of the version being compiled
+JITCompiler::CacheBuild* JITCompiler::s_pCacheBuild = NULL;
+size_t JITCompiler::s_cacheNameCount = 0;
+JITCompiler::LoadingSet JITCompiler::s_loadingVersions;
+
 llvm::Value* JITCompiler::createAddInstr(llvm::IRBuilder<>& builder, llvm::Value* pLVal, llvm::Value* pRVal) { 
 	llvm::Type* ltype = pLVal->getType();
 	if(ltype->isDoubleTy() || ltype->isFloatTy()) return builder.CreateFAdd(pLVal, pRVal); 
@@ -163,23 +213,12 @@ void JITCompiler::initialize()
 	s_pExecEngine = 
       llvm::ExecutionEngine::createJIT(s_pModule, 0, 0, llvm::CodeGenOpt::None);
 	
-	// Create a function pass manager for the module
-	s_pFunctionPasses = new llvm::FunctionPassManager(s_pModule);
-	
-	// Add a verification pass to the function passes
-	s_pFunctionPasses->add(llvm::createVerifierPass(llvm::PrintMessageAction));
+	// Generate callees eagerly, so that running compiled code never
+	// re-enters the code generator outside of the compilation lock
+	s_pExecEngine->DisableLazyCompilation(true);
 	
-	// Add optimization passes to the function passes
-	s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
-	s_pFunctionPasses->add(llvm::createPromoteMemoryToRegisterPass());
-	s_pFunctionPasses->add(llvm::createReassociatePass());
-	s_pFunctionPasses->add(llvm::createConstantPropagationPass());
-    //	s_pFunctionPasses->add(llvm::createCondPropagationPass());
-	s_pFunctionPasses->add(llvm::createDeadCodeEliminationPass());
-	s_pFunctionPasses->add(llvm::createGVNPass());
-	s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
-	s_pFunctionPasses->add(llvm::createBlockPlacementPass());
-	s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+	// NOTE: the optimization passes are created on first use, once
+	// the optimization level has been read from the command line
 	
 	// Create a function pass manager for the module
 	s_pPrintPass = new llvm::FunctionPassManager(s_pModule);	
@@ -218,6 +257,7 @@ void JITCompiler::initialize()
 	callFnArgs.push_back(VOID_PTR_TYPE);
 	callFnArgs.push_back(VOID_PTR_TYPE);
 	callFnArgs.push_back(getIntType(sizeof(size_t)));		
+	callFnArgs.push_back(VOID_PTR_TYPE);
 	
 	// Create a type vector to represent the arguments of scalar matrix operations
 	LLVMTypeVector f64ScalarOpArgs;
@@ -284,6 +324,7 @@ void JITCompiler::initialize()
 	regNativeFunc("ArrayObj::create", (void*)ArrayObj::create, VOID_PTR_TYPE, LLVMTypeVector(1, getIntType(sizeof(size_t))));
 	regNativeFunc("ArrayObj::addObject", (void*)ArrayObj::addObject, llvm::Type::getVoidTy(*s_Context), evalArgs);
 	regNativeFunc("ArrayObj::append", (void*)ArrayObj::append, llvm::Type::getVoidTy(*s_Context), evalArgs);
+	regNativeFunc("FusedArrayOp::evalLeaves", (void*)FusedArrayOp::evalLeaves, VOID_PTR_TYPE, evalArgs);
 	regNativeFunc("ArrayObj::getArrayObj", (void*)ArrayObj::getArrayObj, VOID_PTR_TYPE, getObjArgs);
 	regNativeFunc("ArrayObj::getArraySize", (void*)ArrayObj::getArraySize, getIntType(sizeof(size_t)), LLVMTypeVector(1, VOID_PTR_TYPE));
 	regNativeFunc("Environment::bind", (void*)Environment::bind, VOID_PTR_TYPE, LLVMTypeVector(3, VOID_PTR_TYPE));
@@ -293,7 +334,7 @@ void JITCompiler::initialize()
 	regNativeFunc("ProgFunction::getLocalEnv", (void*)ProgFunction::getLocalEnv, VOID_PTR_TYPE, LLVMTypeVector(1, VOID_PTR_TYPE));
 	regNativeFunc("RunError::throwError", (void*)RunError::throwError, VOID_PTR_TYPE, evalArgs);
 	regNativeFunc("Interpreter::callFunction", (void*)Interpreter::callFunction, VOID_PTR_TYPE, callFnArgs);
-	regNativeFunc("Interpreter::execStatement", (void*)Interpreter::execStatement, llvm::Type::getVoidTy(*s_Context), evalArgs);
+	regNativeFunc("Interpreter::execStatement", (void*)Interpreter::execStatement, getIntType(sizeof(Interpreter::ExecStatus)), evalArgs);
 	regNativeFunc("Interpreter::evalAssignStmt", (void*)Interpreter::evalAssignStmt, llvm::Type::getVoidTy(*s_Context), evalArgs);
 	regNativeFunc("Interpreter::assignObject", (void*)Interpreter::assignObject, llvm::Type::getVoidTy(*s_Context), assignArgs);
 	regNativeFunc("Interpreter::evalExprStmt", (void*)Interpreter::evalExprStmt, llvm::Type::getVoidTy(*s_Context), evalArgs);
@@ -329,6 +370,9 @@ void JITCompiler::initialize()
 	regNativeFunc("LogicalArrayObj::readElem2D", (void*)(LogicalArrayObj::MATRIX_2D_READ_FUNC)LogicalArrayObj::readElem2D, llvm::Type::getInt8Ty(*s_Context), read2DArgs);
 	regNativeFunc("LogicalArrayObj::writeElem1D", (void*)(LogicalArrayObj::MATRIX_1D_WRITE_FUNC)LogicalArrayObj::writeElem1D, llvm::Type::getVoidTy(*s_Context), i8Write1DArgs);
 	regNativeFunc("LogicalArrayObj::writeElem2D", (void*)(LogicalArrayObj::MATRIX_2D_WRITE_FUNC)LogicalArrayObj::writeElem2D, llvm::Type::getVoidTy(*s_Context), i8Write2DArgs);
+	regNativeFunc("MatrixF64Obj::unshareMatrix", (void*)MatrixF64Obj::unshareMatrix, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), false, false, true);
+	regNativeFunc("CharArrayObj::unshareMatrix", (void*)CharArrayObj::unshareMatrix, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), false, false, true);
+	regNativeFunc("LogicalArrayObj::unshareMatrix", (void*)LogicalArrayObj::unshareMatrix, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), false, false, true);
 	
 	// Register addition operation (+) functions
 	regNativeFunc("MatrixF64Obj::binArrayOp<AddOp>", (void*)(MatrixF64Obj::MATRIX_BINOP_FUNC)MatrixF64Obj::binArrayOp<AddOp<float64>, float64>, VOID_PTR_TYPE, evalArgs);
@@ -457,11 +501,18 @@ void JITCompiler::initialize()
 	ConfigManager::registerVar(&s_jitUseBinOpOpts);
 	ConfigManager::registerVar(&s_jitUseLibOpts);
 	ConfigManager::registerVar(&s_jitUseDirectCalls);
+	ConfigManager::registerVar(&s_jitUseCallCaches);
 	ConfigManager::registerVar(&s_jitNoReadBoundChecks);
 	ConfigManager::registerVar(&s_jitNoWriteBoundChecks);
 	ConfigManager::registerVar(&s_jitCopyEnableVar);
     ConfigManager::registerVar(&s_jitOsrEnableVar);
     ConfigManager::registerVar(&s_jitOsrStrategyVar);
+    ConfigManager::registerVar(&s_jitOsrThresholdVar);
+	ConfigManager::registerVar(&s_jitHotThresholdVar);
+	ConfigManager::registerVar(&s_jitBackgroundVar);
+	ConfigManager::registerVar(&s_jitOptLevelVar);
+	ConfigManager::registerVar(&s_aotCompileVar);
+	ConfigManager::registerVar(&s_aotArgTypesVar);
 }
 
 /***************************************************************
@@ -475,6 +526,278 @@ void JITCompiler::initializeOSR() {
   // initialize osr logic data structures
   if (!s_jitOsrEnableVar)
     return;
+
+  // Get the loop selection strategy
+  const std::string& strategy = s_jitOsrStrategyVar.getStringValue();
+
+  // If the strategy is not recognized, fall back to replacing any loop
+  if (strategy != "any" && strategy != "outermost" && strategy != "innermost")
+  {
+    std::cout << "WARNING: unknown OSR strategy \"" << strategy << "\", using \"any\"" << std::endl;
+    s_jitOsrStrategyVar.setValue("any");
+  }
+}
+
+/***************************************************************
+* Function: JITCompiler::getOsrThreshold()
+* Purpose : Get the iteration count at which a loop should be
+*           replaced by compiled code (0 if never)
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t JITCompiler::getOsrThreshold(const LoopStmt* pLoopStmt)
+{
+	// If the JIT or OSR is disabled, or types are being validated, never replace
+	if (s_jitEnableVar.getBoolValue() == false || s_jitOsrEnableVar.getBoolValue() == false ||
+		Interpreter::s_validateTypes.getBoolValue() == true)
+		return 0;
+	
+	// If the loop is excluded by the selection strategy, never replace it
+	const std::string& strategy = s_jitOsrStrategyVar.getStringValue();
+	if ((strategy == "outermost" && pLoopStmt->isOutermost() == false) ||
+		(strategy == "innermost" && pLoopStmt->isInnermost() == false))
+		return 0;
+	
+	// Return the iteration threshold, which must be at least 1
+	return size_t(std::max(s_jitOsrThresholdVar.getIntValue(), 1L));
+}
+
+/***************************************************************
+* Function: JITCompiler::osrEnterLoop()
+* Purpose : Finish the execution of an interpreted loop in
+*           compiled code, at the start of an iteration
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::osrEnterLoop(const LoopStmt* pLoopStmt, Environment* pEnv)
+{
+	// Get the OSR information for this loop
+	// NOTE: the reference is only used before the loop function is called
+	OsrLoop& osrLoop = s_osrLoopMap[pLoopStmt];
+	
+	// If this loop cannot be replaced, stop
+	if (osrLoop.replaceable == false)
+		return false;
+	
+	// Get the symbols used and defined by the loop
+	Expression::SymbolSet uses = pLoopStmt->getSymbolUses();
+	Expression::SymbolSet defs = pLoopStmt->getSymbolDefs();
+	
+	// A return would exit the loop function instead of the enclosing function,
+	// and nargin/nargout would refer to the loop function's arguments
+	if (containsReturn(pLoopStmt->getTestSeq()) || containsReturn(pLoopStmt->getBodySeq()) ||
+		containsReturn(pLoopStmt->getIncrSeq()) ||
+		uses.find(Interpreter::getNarginSym()) != uses.end() ||
+		uses.find(Interpreter::getNargoutSym()) != uses.end())
+	{
+		// Remember that this loop cannot be replaced
+		osrLoop.replaceable = false;
+		return false;
+	}
+	
+	// Get the environment enclosing the interpreter's frame, the loop function
+	// resolves the symbols not passed as arguments there
+	// NOTE: the frame itself changes with every call, the loop function's
+	//       environment is set once and never written afterwards
+	Environment* pBaseEnv = pEnv->getParent();
+	
+	// If the loop does not run in a frame, stay in the interpreter
+	if (pBaseEnv == NULL)
+		return false;
+	
+	// For each symbol used by the loop
+	for (Expression::SymbolSet::iterator itr = uses.begin(); itr != uses.end(); ++itr)
+	{
+		// If the symbol is bound to data, it will be passed as an argument
+		DataObject* pObject = Environment::lookup(pEnv, *itr);
+		if (pObject != NULL && pObject->getType() != DataObject::FUNCTION)
+			continue;
+		
+		// If the frame binds the symbol differently from its enclosing
+		// environment, the loop function cannot resolve it, stay in the interpreter
+		if (pObject != Environment::lookup(pBaseEnv, *itr))
+			return false;
+	}
+	
+	// Attempt to find the loop function for this enclosing environment
+	ProgFunction* pLoopFunc = NULL;
+	for (ProgFunction::FuncVector::iterator itr = osrLoop.loopFuncs.begin(); itr != osrLoop.loopFuncs.end(); ++itr)
+		if (ProgFunction::getLocalEnv(*itr) == pBaseEnv)
+			pLoopFunc = *itr;
+	
+	// If the loop was not extracted for this environment yet
+	if (pLoopFunc == NULL)
+	{
+		// If there are too many loop functions for this loop, stay in the interpreter
+		if (osrLoop.loopFuncs.size() >= OSR_MAX_LOOP_FUNCS)
+			return false;
+		
+		// Create vectors for the loop function parameters
+		ProgFunction::ParamVector inParams;
+		ProgFunction::ParamVector outParams;
+		
+		// Every variable defined by the loop is an output
+		for (Expression::SymbolSet::iterator itr = defs.begin(); itr != defs.end(); ++itr)
+		{
+			// If a variable is not yet bound, it cannot be passed in, the
+			// interpreter tries again at a later iteration
+			if (Environment::lookup(pEnv, *itr) == NULL)
+				return false;
+			
+			// Add the variable to the inputs and outputs
+			inParams.push_back(*itr);
+			outParams.push_back(*itr);
+		}
+		
+		// Every other variable used by the loop and currently bound to data is an input
+		for (Expression::SymbolSet::iterator itr = uses.begin(); itr != uses.end(); ++itr)
+		{
+			// If this symbol is already an input, skip it
+			if (defs.find(*itr) != defs.end())
+				continue;
+			
+			// If the symbol is bound to data, add it to the inputs
+			DataObject* pObject = Environment::lookup(pEnv, *itr);
+			if (pObject != NULL && pObject->getType() != DataObject::FUNCTION)
+				inParams.push_back(*itr);
+		}
+		
+		// Copy the loop, without its initialization code
+		LoopStmt* pLoopCopy = pLoopStmt->copy();
+		LoopStmt* pNewLoop = new LoopStmt(
+			pLoopCopy->getIndexVar(),
+			pLoopCopy->getTestVar(),
+			new StmtSequence(),
+			pLoopCopy->getTestSeq(),
+			pLoopCopy->getBodySeq(),
+			pLoopCopy->getIncrSeq(),
+			pLoopCopy->getAnnotations()
+		);
+		
+		// Create a function executing the rest of the loop
+		// Note: the loop is already lowered, so this creates no temporaries
+		pLoopFunc = new ProgFunction(
+			"$osr_loop",
+			inParams,
+			outParams,
+			ProgFunction::FuncVector(),
+			new StmtSequence(pNewLoop)
+		);
+		
+		// Symbols not passed as arguments are resolved in the enclosing environment
+		ProgFunction::setLocalEnv(pLoopFunc, pBaseEnv);
+		
+		// Add the loop function to the list
+		osrLoop.loopFuncs.push_back(pLoopFunc);
+	}
+	
+	// Get references to the loop function parameters
+	const ProgFunction::ParamVector& inParams = pLoopFunc->getInParams();
+	const ProgFunction::ParamVector& outParams = pLoopFunc->getOutParams();
+	
+	// Create an array for the input arguments
+	ArrayObj* pArguments = new ArrayObj(inParams.size());
+	
+	// For each input parameter
+	for (size_t i = 0; i < inParams.size(); ++i)
+	{
+		// Lookup the current value of the variable
+		DataObject* pValue = Environment::lookup(pEnv, inParams[i]);
+		
+		// If the variable is no longer bound to data, stay in the interpreter
+		if (pValue == NULL || pValue->getType() == DataObject::FUNCTION)
+			return false;
+		
+		// Pass a copy of the value, as a call would
+		ArrayObj::addObject(pArguments, pValue->copy());
+	}
+	
+	// Declare a pointer for the output values
+	ArrayObj* pOutput;
+	
+	// Setup a try block to catch compilation errors
+	try
+	{
+		// Run the rest of the loop in a compiled version specialized
+		// for the current types of the variables
+		pOutput = callFunction(pLoopFunc, pArguments, outParams.size());
+	}
+	
+	// If the loop could not be compiled
+	catch (CompError error)
+	{
+		// Remember that this loop cannot be replaced
+		// NOTE: the call may have added loops to the map, look this one up again
+		s_osrLoopMap[pLoopStmt].replaceable = false;
+		return false;
+	}
+	
+	// Write the final variable values back into the environment
+	for (size_t i = 0; i < outParams.size(); ++i)
+		Environment::bind(pEnv, outParams[i], pOutput->getObject(i));
+	
+	// The loop was executed to completion
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::containsReturn()
+* Purpose : Test if a statement sequence contains a return
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::containsReturn(const StmtSequence* pSeqStmt)
+{
+	// Get a reference to the statement vector
+	const StmtSequence::StmtVector& stmts = pSeqStmt->getStatements();
+	
+	// For each statement
+	for (StmtSequence::StmtVector::const_iterator itr = stmts.begin(); itr != stmts.end(); ++itr)
+	{
+		// Switch on the statement type
+		switch ((*itr)->getStmtType())
+		{
+			// Return statement
+			case Statement::RETURN:
+			{
+				// A return was found
+				return true;
+			}
+			break;
+			
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Test both branches
+				IfElseStmt* pIfStmt = (IfElseStmt*)*itr;
+				if (containsReturn(pIfStmt->getIfBlock()) || containsReturn(pIfStmt->getElseBlock()))
+					return true;
+			}
+			break;
+			
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Test all the loop sequences
+				LoopStmt* pLoopStmt = (LoopStmt*)*itr;
+				if (containsReturn(pLoopStmt->getInitSeq()) || containsReturn(pLoopStmt->getTestSeq()) ||
+					containsReturn(pLoopStmt->getBodySeq()) || containsReturn(pLoopStmt->getIncrSeq()))
+					return true;
+			}
+			break;
+			
+			// Other statements cannot contain a return
+			default:
+			{
+			}
+		}
+	}
+	
+	// No return statement found
+	return false;
 }
 
 
@@ -488,6 +811,22 @@ N.A. Lameed, 2011, 2012.
 */
 void JITCompiler::shutdown()
 {
+	// If the background compilation thread was started
+	if (s_pCompThread != NULL)
+	{
+		// Ask the thread to exit once its current job is done
+		{
+			std::lock_guard<std::recursive_mutex> lock(s_compMutex);
+			s_stopCompThread = true;
+		}
+		s_compCond.notify_all();
+		
+		// Wait for the thread to exit
+		s_pCompThread->join();
+		delete s_pCompThread;
+		s_pCompThread = NULL;
+	}
+	
 	delete s_pFunctionPasses;
 	delete s_pPrintPass;
 
@@ -743,7 +1082,7 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
 			// Lookup the variable in the environment
 			LLVMValueVector lookupArgs;
 			lookupArgs.push_back(getCallEnv(compFunction, compVersion));
-			lookupArgs.push_back(createPtrConst(pSymbol));
+			lookupArgs.push_back(createObjRef(pSymbol));
 			llvm::Value* pReadValue = createNativeCall(
 				currentBuilder,
 				(void*)Environment::lookup,
@@ -831,6 +1170,128 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
 	}
 }
 
+/***************************************************************
+* Function: JITCompiler::compileAheadOfTime()
+* Purpose : Precompile a function into the code cache
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::compileAheadOfTime(const std::string& funcName, const std::string& argTypesText)
+{
+	// Ensure that the JIT compiler is enabled
+	if (s_jitEnableVar.getBoolValue() == false)
+		throw RunError("ahead-of-time compilation requires the JIT compiler to be enabled");
+	
+	// Ensure that the code cache is enabled, otherwise nothing would be kept
+	if (CodeCache::isEnabled() == false)
+		throw RunError("ahead-of-time compilation requires the code cache to be enabled");
+	
+	// Parse the argument types of the entry function
+	TypeSetString argTypeStr = parseArgTypes(argTypesText);
+	
+	// Evaluate the function name in the global environment, loading its file
+	DataObject* pObject = Interpreter::evalGlobalSym(SymbolExpr::getSymbol(funcName));
+	
+	// Ensure the object is a program function
+	if (pObject->getType() != DataObject::FUNCTION || ((Function*)pObject)->isProgFunction() == false)
+		throw RunError("symbol is not bound to a program function");
+	
+	// Get a typed pointer to the function object
+	ProgFunction* pFunction = (ProgFunction*)(Function*)pObject;
+	
+	// If this version of the entry function is not yet compiled
+	FunctionMap::iterator funcItr = s_functionMap.find(pFunction);
+	if (funcItr == s_functionMap.end() || funcItr->second.versions.find(argTypeStr) == funcItr->second.versions.end())
+	{
+		// Compile the entry function, along with the functions it calls directly
+		try
+		{
+			compileFunction(pFunction, argTypeStr);
+		}
+		
+		// If the compilation fails, report it as a run-time error
+		catch (CompError error)
+		{
+			throw RunError("ahead-of-time compilation failed: " + error.getErrorText());
+		}
+	}
+	
+	// Count the compiled versions, and the ones kept in the code cache
+	size_t numVersions = 0;
+	size_t numCached = 0;
+	for (FunctionMap::iterator fItr = s_functionMap.begin(); fItr != s_functionMap.end(); ++fItr)
+	{
+		for (VersionMap::iterator vItr = fItr->second.versions.begin(); vItr != fItr->second.versions.end(); ++vItr)
+		{
+			++numVersions;
+			if (vItr->second.cacheKey.empty() == false)
+				++numCached;
+		}
+	}
+	
+	// Log the result of the precompilation
+	std::cout << "Precompiled " << numVersions << " function version(s), " << numCached << " in the code cache" << std::endl;
+}
+
+/***************************************************************
+* Function: JITCompiler::parseArgTypes()
+* Purpose : Parse a list of argument type names
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+TypeSetString JITCompiler::parseArgTypes(const std::string& argTypesText)
+{
+	// Create a type set string to store the argument types
+	TypeSetString argTypeStr;
+	
+	// Scalar matrix size
+	TypeInfo::DimVector scalarSize;
+	scalarSize.push_back(1);
+	scalarSize.push_back(1);
+	
+	// Split the text into comma-separated type names
+	std::istringstream textStream(argTypesText);
+	std::string typeName;
+	while (std::getline(textStream, typeName, ','))
+	{
+		// Remove the whitespace around the type name
+		size_t first = typeName.find_first_not_of(" \t");
+		size_t last = typeName.find_last_not_of(" \t");
+		typeName = (first == std::string::npos)? "":typeName.substr(first, last - first + 1);
+		
+		// Build the type corresponding to the name
+		TypeInfo type;
+		if (typeName == "double")
+			type = TypeInfo(DataObject::MATRIX_F64, true, true, false, true, scalarSize, NULL, std::set<TypeInfo>());
+		else if (typeName == "int")
+			type = TypeInfo(DataObject::MATRIX_F64, true, true, true, true, scalarSize, NULL, std::set<TypeInfo>());
+		else if (typeName == "complex")
+			type = TypeInfo(DataObject::MATRIX_C128, true, true, false, true, scalarSize, NULL, std::set<TypeInfo>());
+		else if (typeName == "bool")
+			type = TypeInfo(DataObject::LOGICALARRAY, true, true, true, true, scalarSize, NULL, std::set<TypeInfo>());
+		else if (typeName == "char")
+			type = TypeInfo(DataObject::CHARARRAY, true, false, true, false, TypeInfo::DimVector(), NULL, std::set<TypeInfo>());
+		else if (typeName == "matrix")
+			type = TypeInfo(DataObject::MATRIX_F64, true, false, false, false, TypeInfo::DimVector(), NULL, std::set<TypeInfo>());
+		else if (typeName == "int_matrix")
+			type = TypeInfo(DataObject::MATRIX_F64, true, false, true, false, TypeInfo::DimVector(), NULL, std::set<TypeInfo>());
+		else if (typeName == "bool_matrix")
+			type = TypeInfo(DataObject::LOGICALARRAY, true, false, true, false, TypeInfo::DimVector(), NULL, std::set<TypeInfo>());
+		else if (typeName == "cmatrix")
+			type = TypeInfo(DataObject::MATRIX_C128, true, false, false, false, TypeInfo::DimVector(), NULL, std::set<TypeInfo>());
+		else
+			throw RunError("unknown argument type: \"" + typeName + "\"");
+		
+		// Add a type set containing only this type
+		argTypeStr.push_back(typeSetMake(type));
+	}
+	
+	// Return the argument types
+	return argTypeStr;
+}
+
 /***************************************************************
 * Function: JITCompiler::compileFunction()
 * Purpose : Compile a program function given argument types
@@ -838,11 +1299,14 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
 ****************************************************************
 Revisions and bug fixes:
 */
-void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr)
+void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr, bool deferCodeGen)
 {
 	// Ensure that the JIT compiler was initialized
 	assert (s_pModule != NULL && s_pExecEngine != NULL);
 	
+	// Lock the LLVM state against the background compilation thread
+	std::lock_guard<std::recursive_mutex> lock(s_compMutex);
+	
 	PROF_START_TIMER(Profiler::COMP_TIME_TOTAL);
 	
 	// Log that we are compiling this function
@@ -891,11 +1355,41 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 		throw CompError("Function version is already compiled");
 	}
 	
+	// Get the code cache key for this version
+	std::string cacheKey = getCacheKey(compFunction, argTypeStr);
+	
+	// If the version can be cached
+	if (cacheKey.empty() == false)
+	{
+		// If the version is found in the code cache
+		if (loadCachedVersion(compFunction, argTypeStr, cacheKey))
+		{
+			PROF_INCR_COUNTER(Profiler::CODE_CACHE_HIT_COUNT);
+			PROF_STOP_TIMER(Profiler::COMP_TIME_TOTAL);
+			
+			// The version is ready to be called
+			return;
+		}
+		
+		PROF_INCR_COUNTER(Profiler::CODE_CACHE_MISS_COUNT);
+		
+		// If compiling the callees of the cached version compiled this version, stop
+		if (compFunction.versions.find(argTypeStr) != compFunction.versions.end())
+		{
+			PROF_STOP_TIMER(Profiler::COMP_TIME_TOTAL);
+			return;
+		}
+	}
+	
 	// Create an entry for this function version
 	CompVersion& compVersion = compFunction.versions[argTypeStr];
 	
-	// Store the input argument types
+	// Store the input argument types and the code cache key
 	compVersion.inArgTypes = argTypeStr;
+	compVersion.cacheKey = cacheKey;
+	
+	// Begin recording the objects the generated code refers to
+	CacheBuild cacheBuild(pFunction, compFunction.pFuncBody, compVersion.cacheKey.empty() == false);
 	
 	PROF_START_TIMER(Profiler::ANA_TIME_TOTAL);
 	
@@ -1058,8 +1552,18 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 	TypeInfoMap::const_iterator bodyTypeItr = compVersion.pTypeInferInfo->postTypeMap.find(compFunction.pFuncBody);
 	assert (bodyTypeItr != compVersion.pTypeInferInfo->postTypeMap.end());
 	
+	// Get the variables that remain live after the function body
+	// NOTE: the variables written by a script escape into its environment
+	Expression::SymbolSet exitLiveVars = outParamSet;
+	Expression::SymbolSet escapingVars;
+	if (pFunction->isScript())
+	{
+		escapingVars = compFunction.pFuncBody->getSymbolDefs();
+		exitLiveVars.insert(escapingVars.begin(), escapingVars.end());
+	}
+	
 	// Match the variable mappings for the return points
-	VariableMap exitVarMap = matchBranchPoints(compFunction, compVersion, outParamSet, 
+	VariableMap exitVarMap = matchBranchPoints(compFunction, compVersion, exitLiveVars, 
 			bodyTypeItr->second, returnPoints, pExitBlock);
 	
 	//std::cout << "Done matching fn return branch points" << std::endl;
@@ -1067,6 +1571,9 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 	// Create an IR builder for the exit block
 	llvm::IRBuilder<> exitBuilder(pExitBlock);
 	
+	// Write the escaping variables back to the environment
+	writeVariables(exitBuilder, compFunction, compVersion, exitVarMap, escapingVars);
+	
 	// If the function has no return parameters
 	if (outParams.size() == 0)
 	{
@@ -1083,26 +1590,1381 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 	//       to the entry block during compilation, see getCallEnv for details.
 	entryBuilder.CreateBr(pSeqBlock);
 	
+	// If the generated code only refers to objects that can be found again
+	if (cacheBuild.cacheable)
+	{
+		// Keep the reference table and dependencies for the cache entry
+		compVersion.cacheRefs = cacheBuild.refTable;
+		compVersion.cacheDeps = getCacheDeps(pFunction);
+	}
+	else
+	{
+		// Do not store the version in the code cache
+		compVersion.cacheKey.clear();
+	}
+	
+	// If code generation is deferred to the background thread
+	if (deferCodeGen)
+	{
+		// Queue the version, its code pointer remains null
+		// until the optimized machine code is ready
+		s_compQueue.push_back(&compVersion);
+		
+		// Start the background compilation thread if needed
+		if (s_pCompThread == NULL)
+		{
+			// Allow the thread to register itself with the collector
+			GC_allow_register_threads();
+			
+			// Create the compilation thread
+			s_pCompThread = new std::thread(&compThreadMain);
+		}
+		
+		// Wake up the background compilation thread
+		s_compCond.notify_one();
+	}
+	else
+	{
+		// Optimize the function and generate its code now
+		genMachineCode(compVersion);
+	}
+	
+	PROF_STOP_TIMER(Profiler::COMP_TIME_TOTAL);
+}
+
+/***************************************************************
+* Function: JITCompiler::genMachineCode()
+* Purpose : Optimize and generate machine code for a version
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::genMachineCode(CompVersion& version)
+{
+	// Get a pointer to the function object
+	llvm::Function* pFuncObj = version.pLLVMFunc;
+	
+	// At the higher optimization levels, inline the small functions called directly
+	if (s_jitOptLevelVar.getIntValue() >= 2 && inlineDirectCalls(pFuncObj) > 0)
+	{
+		// The inlined code refers to objects of other functions, and cannot be cached
+		version.cacheKey.clear();
+	}
+	
+	// Run the optimization passes on the function
+	runOptPasses(pFuncObj);
+	
+	// If the version can be cached, store its optimized code
+	if (version.cacheKey.empty() == false && storeCachedVersion(version) == false)
+		version.cacheKey.clear();
+	
+	// Get a function pointer to the compiled function
+	COMP_FUNC_PTR pFuncPtr = (COMP_FUNC_PTR)s_pExecEngine->getPointerToFunction(pFuncObj);
+	
+	// If we are in verbose mode
+	if (ConfigManager::s_verboseVar)
+	{
+		// Log that compilation is complete
+		std::cout << "Compilation complete" << std::endl;
+		
+		// Run the pretty-printer pass on the function
+		s_pPrintPass->run(*pFuncObj);
+	}
+	
+	// Store a pointer to the compiled function code, callers test
+	// it without holding the compilation lock, so the store must
+	// be ordered after the generated code is written
+	__atomic_store_n(&version.pFuncPtr, pFuncPtr, __ATOMIC_RELEASE);
+}
+
+/***************************************************************
+* Function: JITCompiler::finishPendingVersion()
+* Purpose : Generate the code of a pending version immediately
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::finishPendingVersion(CompVersion& version)
+{
+	// Lock the LLVM state, so that the background thread is idle
+	std::lock_guard<std::recursive_mutex> lock(s_compMutex);
+	
+	// Find the version in the code generation queue
+	CompQueue::iterator itr = std::find(s_compQueue.begin(), s_compQueue.end(), &version);
+	
+	// If the version is not queued, its code is ready or
+	// it is still being compiled (recursive call), stop
+	if (itr == s_compQueue.end())
+		return;
+	
+	// Take the version out of the queue and generate its code
+	s_compQueue.erase(itr);
+	genMachineCode(version);
+}
+
+/***************************************************************
+* Function: JITCompiler::runOptPasses()
+* Purpose : Run the optimization passes on a function
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::runOptPasses(llvm::Function* pFuncObj)
+{
+	// If the optimization passes were not yet created, create them
+	if (s_pFunctionPasses == NULL)
+		createOptPasses();
+	
 	// Run the optimization passes on the function
 	s_pFunctionPasses->run(*pFuncObj);
+}
+
+/***************************************************************
+* Function: JITCompiler::createOptPasses()
+* Purpose : Create the optimization passes for the current level
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::createOptPasses()
+{
+	// Get the optimization level
+	long int optLevel = s_jitOptLevelVar.getIntValue();
+	
+	// Create a function pass manager for the module
+	s_pFunctionPasses = new llvm::FunctionPassManager(s_pModule);
+	
+	// Add a verification pass to the function passes
+	s_pFunctionPasses->add(llvm::createVerifierPass(llvm::PrintMessageAction));
+	
+	// At level 0, only promote stack variables to registers and clean up the control flow
+	if (optLevel == 0)
+	{
+		s_pFunctionPasses->add(llvm::createPromoteMemoryToRegisterPass());
+		s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+		return;
+	}
+	
+	// At level 1, run the default scalar optimizations
+	if (optLevel == 1)
+	{
+		s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+		s_pFunctionPasses->add(llvm::createPromoteMemoryToRegisterPass());
+		s_pFunctionPasses->add(llvm::createReassociatePass());
+		s_pFunctionPasses->add(llvm::createConstantPropagationPass());
+		s_pFunctionPasses->add(llvm::createDeadCodeEliminationPass());
+		s_pFunctionPasses->add(llvm::createGVNPass());
+		s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
+		s_pFunctionPasses->add(llvm::createBlockPlacementPass());
+		s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+		return;
+	}
+	
+	// Give the passes the target data layout
+	s_pFunctionPasses->add(new llvm::DataLayout(*s_data_layout));
+	
+	// Simplify the code produced by the code generator and the inliner
+	s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+	s_pFunctionPasses->add(llvm::createScalarReplAggregatesPass());
+	s_pFunctionPasses->add(llvm::createEarlyCSEPass());
+	s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
+	s_pFunctionPasses->add(llvm::createReassociatePass());
+	s_pFunctionPasses->add(llvm::createJumpThreadingPass());
+	s_pFunctionPasses->add(llvm::createCorrelatedValuePropagationPass());
+	s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+	
+	// Hoist loop invariants, such as matrix data pointers and sizes,
+	// simplify the induction variables and unroll small loops
+	s_pFunctionPasses->add(llvm::createLoopSimplifyPass());
+	s_pFunctionPasses->add(llvm::createLoopRotatePass());
+	s_pFunctionPasses->add(llvm::createLICMPass());
+	s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
+	s_pFunctionPasses->add(llvm::createIndVarSimplifyPass());
+	s_pFunctionPasses->add(llvm::createLoopDeletionPass());
+	s_pFunctionPasses->add(llvm::createLoopUnrollPass());
+	
+	// At level 3, vectorize loops and straight-line code
+	if (optLevel >= 3)
+	{
+		s_pFunctionPasses->add(llvm::createLoopVectorizePass());
+		s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
+		s_pFunctionPasses->add(llvm::createBBVectorizePass());
+	}
+	
+	// Remove the redundant computations and dead code left
+	s_pFunctionPasses->add(llvm::createGVNPass());
+	s_pFunctionPasses->add(llvm::createSCCPPass());
+	s_pFunctionPasses->add(llvm::createInstructionCombiningPass());
+	s_pFunctionPasses->add(llvm::createDeadStoreEliminationPass());
+	s_pFunctionPasses->add(llvm::createAggressiveDCEPass());
+	s_pFunctionPasses->add(llvm::createBlockPlacementPass());
+	s_pFunctionPasses->add(llvm::createCFGSimplificationPass());
+}
+
+/***************************************************************
+* Function: JITCompiler::inlineDirectCalls()
+* Purpose : Inline the small compiled functions called directly
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t JITCompiler::inlineDirectCalls(llvm::Function* pFuncObj)
+{
+	// Declare a vector for the calls to inline
+	std::vector<llvm::CallInst*> calls;
+	
+	// For each instruction of the function
+	for (llvm::Function::iterator blockItr = pFuncObj->begin(); blockItr != pFuncObj->end(); ++blockItr)
+	{
+		for (llvm::BasicBlock::iterator instItr = blockItr->begin(); instItr != blockItr->end(); ++instItr)
+		{
+			// If this is not a direct call, skip it
+			llvm::CallInst* pCall = llvm::dyn_cast<llvm::CallInst>(&*instItr);
+			if (pCall == NULL || pCall->getCalledFunction() == NULL)
+				continue;
+			
+			// Get the called function
+			llvm::Function* pCallee = pCall->getCalledFunction();
+			
+			// Only inline other compiled functions whose machine code was generated,
+			// since the body of a function still being compiled is incomplete
+			if (pCallee == pFuncObj || pCallee->isDeclaration() || s_pExecEngine->getPointerToGlobalIfAvailable(pCallee) == NULL)
+				continue;
+			
+			// Count the instructions of the called function
+			size_t numInstrs = 0;
+			for (llvm::Function::iterator calleeItr = pCallee->begin(); calleeItr != pCallee->end(); ++calleeItr)
+				numInstrs += calleeItr->size();
+			
+			// If the called function is small enough, inline the call
+			if (numInstrs <= INLINE_MAX_INSTRS)
+				calls.push_back(pCall);
+		}
+	}
+	
+	// Inline each call selected
+	size_t numInlined = 0;
+	for (std::vector<llvm::CallInst*>::iterator callItr = calls.begin(); callItr != calls.end(); ++callItr)
+	{
+		llvm::InlineFunctionInfo inlineInfo(NULL, s_data_layout);
+		if (llvm::InlineFunction(*callItr, inlineInfo))
+			++numInlined;
+	}
+	
+	// Return the number of calls inlined
+	return numInlined;
+}
+
+/***************************************************************
+* Function: JITCompiler::compThreadMain()
+* Purpose : Entry point of the background compilation thread
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::compThreadMain()
+{
+	// Register this thread with the garbage collector so that
+	// its stack is scanned, code generation reads collected
+	// objects such as the queued versions and the IIR
+	GC_stack_base stackBase;
+	GC_get_stack_base(&stackBase);
+	GC_register_my_thread(&stackBase);
+	
+	// Hold the compilation lock, except while waiting for work
+	std::unique_lock<std::recursive_mutex> lock(s_compMutex);
+	
+	// Until the thread is asked to stop
+	for (;;)
+	{
+		// Wait for a version to be queued
+		while (s_compQueue.empty() && s_stopCompThread == false)
+			s_compCond.wait(lock);
+		
+		// If the thread was asked to stop, exit the loop
+		if (s_stopCompThread)
+			break;
+		
+		// Take the oldest queued version
+		CompVersion* pVersion = s_compQueue.front();
+		s_compQueue.pop_front();
+		
+		// Optimize the function and generate its code
+		genMachineCode(*pVersion);
+	}
+	
+	// Release the compilation lock
+	lock.unlock();
+	
+	// Unregister this thread from the garbage collector
+	GC_unregister_my_thread();
+}
+
+/***************************************************************
+* Function: JITCompiler::CacheBuild::CacheBuild()
+* Purpose : Make a code cache record the active one
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+JITCompiler::CacheBuild::CacheBuild(ProgFunction* pFunc, const StmtSequence* pFuncBody, bool enabled)
+: pFunction(pFunc), cacheable(enabled), pPrevBuild(s_pCacheBuild)
+{
+	// If the version may be cached
+	if (enabled)
+	{
+		// List the nodes of the function body
+		NodeVector nodes;
+		listIIRNodes(pFuncBody, nodes);
+		
+		// Index the nodes, keeping the first index of shared nodes
+		for (size_t i = 0; i < nodes.size(); ++i)
+			nodeIndices.insert(NodeIndexMap::value_type(nodes[i], i));
+	}
+	
+	// Make this record the active one
+	// NOTE: versions compiled while this one is being compiled
+	//       get their own record, or none if they are not cached
+	s_pCacheBuild = enabled? this:NULL;
+}
+
+/***************************************************************
+* Function: JITCompiler::CacheBuild::~CacheBuild()
+* Purpose : Restore the previously active code cache record
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+JITCompiler::CacheBuild::~CacheBuild()
+{
+	// Restore the previously active record
+	s_pCacheBuild = pPrevBuild;
+}
+
+/***************************************************************
+* Function: JITCompiler::getCacheKey()
+* Purpose : Get the code cache key of a function version
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string JITCompiler::getCacheKey(const CompFunction& function, const TypeSetString& argTypeStr)
+{
+	// If the code cache is disabled, the version has no key
+	if (CodeCache::isEnabled() == false)
+		return "";
+	
+	// Get a pointer to the program function
+	ProgFunction* pFunction = function.pProgFunc;
+	
+	// Get the function name
+	const std::string& funcName = pFunction->getFuncName();
+	
+	// If the function cannot be found by name in another run
+	// (generated, nested or closure function), it is not cached
+	if (funcName.empty() || funcName[0] == '$' || pFunction->getParent() != NULL ||
+		pFunction->isClosure() || pFunction->getClosureCode() != NULL || ProgFunction::getLocalEnv(pFunction) == NULL)
+		return "";
+	
+	// Begin the key with the cache format version
+	std::string keyText = "mcvm jit code 1\n";
+	
+	// List the names of the native functions, the cached code refers to them by name
+	std::vector<std::string> nativeNames;
+	for (NativeMap::const_iterator itr = s_nativeMap.begin(); itr != s_nativeMap.end(); ++itr)
+		nativeNames.push_back(itr->second.name);
+	std::sort(nativeNames.begin(), nativeNames.end());
+	
+	// Add a hash of the native function names to the key
+	std::string nativeText;
+	for (size_t i = 0; i < nativeNames.size(); ++i)
+		nativeText += nativeNames[i] + "\n";
+	keyText += "natives " + ::toString(ParseCache::hashBytes(nativeText.data(), nativeText.length())) + "\n";
+	
+	// Add the options that change the generated code to the key
+	const ConfigVar* flagVars[] =
+	{
+		&s_jitUseArrayOpts, &s_jitUseBinOpOpts, &s_jitUseLibOpts, &s_jitUseDirectCalls, &s_jitUseCallCaches,
+		&s_jitNoReadBoundChecks, &s_jitNoWriteBoundChecks, &s_jitCopyEnableVar, &s_jitOsrEnableVar
+	};
+	keyText += "flags ";
+	for (size_t i = 0; i < sizeof(flagVars) / sizeof(flagVars[0]); ++i)
+		keyText += flagVars[i]->getBoolValue()? '1':'0';
+	keyText += " " + s_jitOsrStrategyVar.getStringValue() + "\n";
+	keyText += "opt " + ::toString(s_jitOptLevelVar.getIntValue()) + "\n";
+	
+	// Add the argument types to the key
+	for (size_t i = 0; i < argTypeStr.size(); ++i)
+	{
+		keyText += "arg";
+		for (TypeSet::const_iterator typeItr = argTypeStr[i].begin(); typeItr != argTypeStr[i].end(); ++typeItr)
+			keyText += " {" + typeItr->toString() + "}";
+		keyText += "\n";
+	}
+	
+	// Add the function source and the transformed body the code was generated from
+	// NOTE: the transformed body also fixes the node indices of the reference table
+	keyText += "source " + ::toString(getSourceHash(pFunction)) + "\n";
+	keyText += function.pFuncBody->toString();
+	
+	// Return the key text
+	return keyText;
+}
+
+/***************************************************************
+* Function: JITCompiler::getSourceHash()
+* Purpose : Get the source hash of a program function
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+uint64 JITCompiler::getSourceHash(const ProgFunction* pFunction)
+{
+	// Write the function signature
+	std::string sourceText = pFunction->getFuncName() + "(";
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	for (size_t i = 0; i < inParams.size(); ++i)
+		sourceText += inParams[i]->toString() + ",";
+	sourceText += ") -> (";
+	const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
+	for (size_t i = 0; i < outParams.size(); ++i)
+		sourceText += outParams[i]->toString() + ",";
+	sourceText += ")\n";
+	
+	// Write the original function body
+	sourceText += pFunction->getOrigBody()->toString();
+	
+	// Write the hashes of the nested functions
+	const ProgFunction::FuncVector& nestedFuncs = pFunction->getNestedFuncs();
+	for (size_t i = 0; i < nestedFuncs.size(); ++i)
+		sourceText += "\nnested " + ::toString(getSourceHash(nestedFuncs[i]));
+	
+	// Return the hash of the source text
+	return ParseCache::hashBytes(sourceText.data(), sourceText.length());
+}
+
+/***************************************************************
+* Function: JITCompiler::getCacheDeps()
+* Purpose : List the program functions a function may depend on
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string JITCompiler::getCacheDeps(ProgFunction* pFunction)
+{
+	// Declare a string for the dependency list
+	std::string depText;
+	
+	// Declare a set of visited functions and a work list
+	std::set<const ProgFunction*> visited;
+	std::vector<const ProgFunction*> workList(1, pFunction);
+	visited.insert(pFunction);
+	
+	// Until all reachable functions are visited
+	while (workList.empty() == false)
+	{
+		// Take a function from the work list
+		const ProgFunction* pCurFunc = workList.back();
+		workList.pop_back();
+		
+		// Get the local environment of the function
+		Environment* pLocalEnv = ProgFunction::getLocalEnv(pCurFunc);
+		if (pLocalEnv == NULL)
+			continue;
+		
+		// Get the symbols used by the function
+		Expression::SymbolSet symbols = pCurFunc->getSymbolUses();
+		
+		// For each symbol
+		for (Expression::SymbolSet::const_iterator itr = symbols.begin(); itr != symbols.end(); ++itr)
+		{
+			// Lookup the symbol in the environment, without loading any file
+			DataObject* pObject = Environment::lookup(pLocalEnv, *itr);
+			
+			// If the object is not a program function, skip it
+			if (pObject == NULL || pObject->getType() != DataObject::FUNCTION || ((Function*)pObject)->isProgFunction() == false)
+				continue;
+			
+			// If the function was already visited, skip it
+			ProgFunction* pCallee = (ProgFunction*)(Function*)pObject;
+			if (visited.insert(pCallee).second == false)
+				continue;
+			
+			// Visit the callees of the function
+			workList.push_back(pCallee);
+			
+			// Add top-level functions to the list, nested
+			// ones are covered by the source of their parent
+			if (pCallee->getParent() == NULL)
+				depText += pCallee->getFuncName() + " " + ::toString(getSourceHash(pCallee)) + "\n";
+		}
+	}
+	
+	// Return the dependency list
+	return depText;
+}
+
+/***************************************************************
+* Function: JITCompiler::listIIRNodes()
+* Purpose : List the nodes of a function body in a fixed order
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::listIIRNodes(const IIRNode* pNode, NodeVector& nodes)
+{
+	// If the node is null, do nothing
+	if (pNode == NULL)
+		return;
+	
+	// Add the node to the list
+	nodes.push_back(pNode);
+	
+	// If this is a statement sequence
+	if (pNode->getType() == IIRNode::SEQUENCE)
+	{
+		// List the nodes of each statement
+		const StmtSequence::StmtVector& stmts = ((const StmtSequence*)pNode)->getStatements();
+		for (StmtSequence::StmtVector::const_iterator itr = stmts.begin(); itr != stmts.end(); ++itr)
+			listIIRNodes(*itr, nodes);
+	}
+	
+	// If this is an expression
+	else if (pNode->getType() == IIRNode::EXPRESSION)
+	{
+		// List the nodes of each sub-expression
+		Expression::ExprVector subExprs = ((const Expression*)pNode)->getSubExprs();
+		for (Expression::ExprVector::const_iterator itr = subExprs.begin(); itr != subExprs.end(); ++itr)
+			listIIRNodes(*itr, nodes);
+	}
+	
+	// If this is a statement
+	else if (pNode->getType() == IIRNode::STATEMENT)
+	{
+		// Get a typed pointer to the statement
+		const Statement* pStmt = (const Statement*)pNode;
+		
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Expression statement
+			case Statement::EXPR:
+			listIIRNodes(((const ExprStmt*)pStmt)->getExpression(), nodes);
+			break;
+			
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+				Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+				for (Expression::ExprVector::const_iterator itr = leftExprs.begin(); itr != leftExprs.end(); ++itr)
+					listIIRNodes(*itr, nodes);
+				listIIRNodes(pAssignStmt->getRightExpr(), nodes);
+			}
+			break;
+			
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+				listIIRNodes(pIfStmt->getCondition(), nodes);
+				listIIRNodes(pIfStmt->getIfBlock(), nodes);
+				listIIRNodes(pIfStmt->getElseBlock(), nodes);
+			}
+			break;
+			
+			// Loop statement
+			case Statement::LOOP:
+			{
+				const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+				listIIRNodes(pLoopStmt->getIndexVar(), nodes);
+				listIIRNodes(pLoopStmt->getTestVar(), nodes);
+				listIIRNodes(pLoopStmt->getInitSeq(), nodes);
+				listIIRNodes(pLoopStmt->getTestSeq(), nodes);
+				listIIRNodes(pLoopStmt->getBodySeq(), nodes);
+				listIIRNodes(pLoopStmt->getIncrSeq(), nodes);
+			}
+			break;
+			
+			// Other statements have no sub-nodes
+			default:
+			break;
+		}
+	}
+}
+
+/***************************************************************
+* Function: JITCompiler::loadCachedVersion()
+* Purpose : Load a function version from the code cache
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::loadCachedVersion(CompFunction& function, const TypeSetString& argTypeStr, const std::string& keyText)
+{
+	// Create a key for this version
+	HotCountKey versionKey(function.pProgFunc, argTypeStr);
+	
+	// If this version is already being loaded (mutually recursive
+	// callees), it must be compiled instead
+	if (s_loadingVersions.find(versionKey) != s_loadingVersions.end())
+		return false;
+	
+	// Mark the version as being loaded
+	s_loadingVersions.insert(versionKey);
+	
+	// Declare a variable for the load result
+	bool loaded = false;
+	
+	// Setup a try block to unmark the version on errors
+	try
+	{
+		// Attempt to link the cached version
+		loaded = linkCachedVersion(function, argTypeStr, keyText);
+	}
+	
+	// If compiling a callee failed
+	catch (CompError error)
+	{
+		// The cached version cannot be used
+		loaded = false;
+	}
+	
+	// The version is no longer being loaded
+	s_loadingVersions.erase(versionKey);
+	
+	// Return the load result
+	return loaded;
+}
+
+/***************************************************************
+* Function: JITCompiler::linkCachedVersion()
+* Purpose : Link a cached function version into the module
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::linkCachedVersion(CompFunction& function, const TypeSetString& argTypeStr, const std::string& keyText)
+{
+	// Look up the cache entry for this version
+	CodeCache::SectionVector sections;
+	if (CodeCache::lookup(keyText, sections) == false || sections.size() != 5)
+		return false;
+	
+	// Get a pointer to the function and its local environment
+	ProgFunction* pFunction = function.pProgFunc;
+	Environment* pLocalEnv = ProgFunction::getLocalEnv(pFunction);
+	
+	// Ensure that the functions the version depends on are unchanged
+	std::istringstream depStream(sections[1]);
+	std::string depName;
+	uint64 depHash;
+	while (depStream >> depName >> depHash)
+	{
+		// Lookup the function, loading its file if needed
+		DataObject* pObject = NULL;
+		try { pObject = Interpreter::evalSymbol(SymbolExpr::getSymbol(depName), pLocalEnv); }
+		catch (RunError error) {}
+		
+		// If the function is missing or its source changed, the entry is stale
+		if (pObject == NULL || pObject->getType() != DataObject::FUNCTION || ((Function*)pObject)->isProgFunction() == false ||
+			getSourceHash((ProgFunction*)(Function*)pObject) != depHash)
+			return false;
+	}
+	
+	// List the nodes of the function body
+	NodeVector nodes;
+	listIIRNodes(function.pFuncBody, nodes);
+	
+	// Declare a map of reference names to the objects they stand for
+	std::map<std::string, const void*> refObjects;
+	
+	// Declare a map of callee declaration names to the compiled callees
+	std::map<std::string, llvm::Function*> refCallees;
+	
+	// For each line of the reference table
+	std::istringstream refStream(sections[0]);
+	std::string refLine;
+	while (std::getline(refStream, refLine))
+	{
+		// Read the reference name, kind and argument
+		std::istringstream lineStream(refLine);
+		std::string refName, refKind, refArg;
+		lineStream >> refName >> refKind >> refArg;
+		
+		// Declare a pointer for the object referred to
+		const IIRNode* pObject = NULL;
+		
+		// If this is the function itself
+		if (refKind == "F")
+		{
+			pObject = pFunction;
+		}
+		
+		// If this is a symbol
+		else if (refKind == "S")
+		{
+			pObject = SymbolExpr::getSymbol(refArg);
+		}
+		
+		// If this is a called function or function version
+		else if (refKind == "C" || refKind == "V")
+		{
+			// Lookup the function, loading its file if needed
+			DataObject* pCallee = NULL;
+			try { pCallee = Interpreter::evalSymbol(SymbolExpr::getSymbol(refArg), pLocalEnv); }
+			catch (RunError error) {}
+			
+			// If this is the function the code was compiled against, use it
+			if (pCallee != NULL && pCallee->getType() == DataObject::FUNCTION && ((Function*)pCallee)->getFuncName() == refArg)
+				pObject = (Function*)pCallee;
+			
+			// If this is a version of a program function called directly
+			if (pObject != NULL && refKind == "V")
+			{
+				// Read the argument types of the version
+				TypeSetString calleeArgTypes;
+				if (((Function*)pCallee)->isProgFunction() == false || readTypeSetStr(lineStream, pLocalEnv, calleeArgTypes) == false)
+					return false;
+				
+				// Get the compiled callee version, compiling it if needed
+				// NOTE: the callee version may itself be in the code cache
+				ProgFunction* pCalleeFunc = (ProgFunction*)(Function*)pCallee;
+				FunctionMap::iterator funcItr = s_functionMap.find(pCalleeFunc);
+				if (funcItr == s_functionMap.end() || funcItr->second.versions.find(calleeArgTypes) == funcItr->second.versions.end())
+					compileFunction(pCalleeFunc, calleeArgTypes);
+				
+				// Find the callee version
+				funcItr = s_functionMap.find(pCalleeFunc);
+				if (funcItr == s_functionMap.end())
+					return false;
+				VersionMap::iterator versionItr = funcItr->second.versions.find(calleeArgTypes);
+				if (versionItr == funcItr->second.versions.end())
+					return false;
+				
+				// Store the callee function object
+				refCallees[refName] = versionItr->second.pLLVMFunc;
+				continue;
+			}
+		}
+		
+		// If this is a function body node
+		else if (refKind == "N")
+		{
+			// Get the node at this index
+			size_t nodeIndex = atol(refArg.c_str());
+			if (nodeIndex < nodes.size())
+				pObject = nodes[nodeIndex];
+		}
+		
+		// If the object could not be found, the entry cannot be used
+		if (pObject == NULL)
+			return false;
+		
+		// Store the object for this reference
+		refObjects[refName] = pObject;
+	}
+	
+	// Read the input and output argument object types
+	std::vector<DataObject::Type> inObjTypes;
+	std::vector<DataObject::Type> outObjTypes;
+	std::istringstream inTypeStream(sections[2]);
+	std::istringstream outTypeStream(sections[3]);
+	int objType;
+	while (inTypeStream >> objType)
+		inObjTypes.push_back((DataObject::Type)objType);
+	while (outTypeStream >> objType)
+		outObjTypes.push_back((DataObject::Type)objType);
+	
+	// Parse the bitcode of the cached function
+	// NOTE: the bitcode reader does not take ownership of the buffer
+	llvm::MemoryBuffer* pBuffer = llvm::MemoryBuffer::getMemBuffer(sections[4], "", false);
+	std::string errorText;
+	llvm::Module* pCacheModule = llvm::ParseBitcodeFile(pBuffer, *s_Context, &errorText);
+	delete pBuffer;
+	
+	// If the bitcode could not be parsed, stop
+	if (pCacheModule == NULL)
+		return false;
+	
+	// Declare a pointer for the cached function
+	llvm::Function* pCachedFunc = NULL;
+	
+	// Indicates if the cached module can be linked in
+	bool linkable = true;
+	
+	// For each function of the cached module
+	for (llvm::Module::iterator funcItr = pCacheModule->begin(); funcItr != pCacheModule->end(); ++funcItr)
+	{
+		// Get a pointer to the function
+		llvm::Function* pFunc = &*funcItr;
+		
+		// If this is the cached function, store it, there must be only one
+		if (pFunc->isDeclaration() == false)
+		{
+			linkable = linkable && (pCachedFunc == NULL);
+			pCachedFunc = pFunc;
+			continue;
+		}
+		
+		// If this is an intrinsic, it needs no checks
+		if (pFunc->isIntrinsic())
+			continue;
+		
+		// If this is a compiled callee, it must have the same type
+		std::map<std::string, llvm::Function*>::iterator calleeItr = refCallees.find(pFunc->getName().str());
+		if (calleeItr != refCallees.end())
+		{
+			// Give the declaration the name of the callee, so that it links to it
+			linkable = linkable && calleeItr->second->getFunctionType() == pFunc->getFunctionType();
+			pFunc->setName(calleeItr->second->getName());
+			linkable = linkable && pFunc->getName() == calleeItr->second->getName();
+			continue;
+		}
+		
+		// Otherwise, it must be a native function registered here with the same type
+		llvm::Function* pNative = s_pModule->getFunction(pFunc->getName());
+		linkable = linkable && pNative != NULL && pNative->isDeclaration() && pNative->getFunctionType() == pFunc->getFunctionType();
+	}
+	
+	// Declare a map of renamed references to the objects they stand for
+	std::map<std::string, const void*> linkRefs;
+	
+	// For each global variable of the cached module
+	for (llvm::Module::global_iterator globalItr = pCacheModule->global_begin(); globalItr != pCacheModule->global_end(); ++globalItr)
+	{
+		// Get a pointer to the global variable
+		llvm::GlobalVariable* pGlobal = &*globalItr;
+		
+		// If this global is defined in the module (constant strings), keep it
+		if (pGlobal->isDeclaration() == false)
+			continue;
+		
+		// Otherwise, it must be a reference from the table
+		std::map<std::string, const void*>::iterator refItr = refObjects.find(pGlobal->getName().str());
+		if (refItr == refObjects.end())
+		{
+			linkable = false;
+			break;
+		}
+		
+		// Give the reference a name unique in this run
+		std::string newName = "mcvm.ref." + ::toString(s_cacheNameCount++);
+		pGlobal->setName(newName);
+		linkRefs[newName] = refItr->second;
+	}
+	
+	// Ensure that the cached function has the expected signature
+	linkable = linkable && pCachedFunc != NULL && pCachedFunc->arg_size() == 2;
+	llvm::StructType* pInStructType = NULL;
+	llvm::StructType* pOutStructType = NULL;
+	if (linkable)
+	{
+		pInStructType = llvm::dyn_cast<llvm::StructType>(
+			llvm::cast<llvm::PointerType>(pCachedFunc->getFunctionType()->getParamType(0))->getElementType());
+		pOutStructType = llvm::dyn_cast<llvm::StructType>(
+			llvm::cast<llvm::PointerType>(pCachedFunc->getFunctionType()->getParamType(1))->getElementType());
+		linkable = 
+			pInStructType != NULL && pInStructType->getNumElements() == inObjTypes.size() &&
+			pOutStructType != NULL && pOutStructType->getNumElements() == outObjTypes.size();
+	}
+	
+	// Give the function a name unique in this run
+	std::string funcName = pFunction->getFuncName() + "_cached_" + ::toString(s_cacheNameCount++);
+	if (linkable)
+		pCachedFunc->setName(funcName);
+	
+	// If compiling the callees compiled this version, or if the
+	// module cannot be linked into the module holding our functions
+	if (linkable == false || function.versions.find(argTypeStr) != function.versions.end() ||
+		llvm::Linker::LinkModules(s_pModule, pCacheModule, llvm::Linker::DestroySource, &errorText))
+	{
+		delete pCacheModule;
+		return false;
+	}
+	delete pCacheModule;
+	
+	// Map the references to the objects they stand for
+	for (std::map<std::string, const void*>::iterator itr = linkRefs.begin(); itr != linkRefs.end(); ++itr)
+		s_pExecEngine->addGlobalMapping(s_pModule->getNamedGlobal(itr->first), (void*)itr->second);
+	
+	// Create an entry for this function version
+	CompVersion& version = function.versions[argTypeStr];
+	
+	// Store the input argument types and the code cache key
+	version.inArgTypes = argTypeStr;
+	version.cacheKey = keyText;
+	
+	// The version has no analysis information
+	version.pReachDefInfo = NULL;
+	version.pLiveVarInfo = NULL;
+	version.pTypeInferInfo = NULL;
+	version.pMetricsInfo = NULL;
+	version.pBoundsCheckInfo = NULL;
+	version.pArrayCopyInfo = NULL;
+	
+	// Store the argument storage modes and object types
+	version.inArgStoreModes.assign(pInStructType->element_begin(), pInStructType->element_end());
+	version.inArgObjTypes = inObjTypes;
+	version.pInStructType = pInStructType;
+	version.outArgStoreModes.assign(pOutStructType->element_begin(), pOutStructType->element_end());
+	version.outArgObjTypes = outObjTypes;
+	version.pOutStructType = pOutStructType;
+	
+	// Store a pointer to the LLVM function object
+	version.pLLVMFunc = s_pModule->getFunction(funcName);
+	
+	// Generate the machine code for the function
+	COMP_FUNC_PTR pFuncPtr = (COMP_FUNC_PTR)s_pExecEngine->getPointerToFunction(version.pLLVMFunc);
+	__atomic_store_n(&version.pFuncPtr, pFuncPtr, __ATOMIC_RELEASE);
+	
+	// If we are in verbose mode, log that the version was loaded
+	if (ConfigManager::s_verboseVar)
+		std::cout << "Function version loaded from the code cache" << std::endl;
+	
+	// The version was loaded
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::storeCachedVersion()
+* Purpose : Store a function version in the code cache
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::storeCachedVersion(const CompVersion& version)
+{
+	// Get a pointer to the function object
+	llvm::Function* pFuncObj = version.pLLVMFunc;
+	
+	// Create a module holding only this function
+	llvm::Module* pCacheModule = new llvm::Module("mcvm_code_cache", *s_Context);
+	llvm::Function* pNewFunc = llvm::Function::Create(
+		pFuncObj->getFunctionType(),
+		llvm::Function::ExternalLinkage,
+		pFuncObj->getName(),
+		pCacheModule
+	);
+	
+	// Map the function and its arguments to the new ones
+	llvm::ValueToValueMapTy valueMap;
+	valueMap[pFuncObj] = pNewFunc;
+	llvm::Function::arg_iterator newArgItr = pNewFunc->arg_begin();
+	for (llvm::Function::arg_iterator argItr = pFuncObj->arg_begin(); argItr != pFuncObj->arg_end(); ++argItr, ++newArgItr)
+		valueMap[&*argItr] = &*newArgItr;
+	
+	// Add the operands of all instructions to a work list
+	std::vector<const llvm::Value*> workList;
+	for (llvm::Function::iterator blockItr = pFuncObj->begin(); blockItr != pFuncObj->end(); ++blockItr)
+		for (llvm::BasicBlock::iterator instrItr = blockItr->begin(); instrItr != blockItr->end(); ++instrItr)
+			for (unsigned i = 0; i < instrItr->getNumOperands(); ++i)
+				workList.push_back(instrItr->getOperand(i));
+	
+	// Indicates if the function can be stored
+	bool storable = true;
+	
+	// Declare a set of the visited constants
+	std::set<const llvm::Value*> visited;
+	
+	// Declare the globals the function uses in the new module
+	while (workList.empty() == false && storable)
+	{
+		// Take a value from the work list
+		const llvm::Value* pValue = workList.back();
+		workList.pop_back();
+		
+		// Only visit each constant once
+		if (llvm::isa<llvm::Constant>(pValue) == false || visited.insert(pValue).second == false)
+			continue;
+		
+		// If this is a function
+		if (const llvm::Function* pFunc = llvm::dyn_cast<llvm::Function>(pValue))
+		{
+			// Recursive calls refer to the new function
+			if (pFunc == pFuncObj)
+				continue;
+			
+			// Other compiled functions must be found again through the reference table
+			if (pFunc->isDeclaration() == false && ("\n" + version.cacheRefs).find("\n" + pFunc->getName().str() + " V ") == std::string::npos)
+			{
+				storable = false;
+				continue;
+			}
+			
+			// Declare the function by name
+			llvm::Function* pDecl = llvm::Function::Create(
+				pFunc->getFunctionType(),
+				llvm::Function::ExternalLinkage,
+				pFunc->getName(),
+				pCacheModule
+			);
+			pDecl->setAttributes(pFunc->getAttributes());
+			valueMap[pFunc] = pDecl;
+		}
+		
+		// If this is a global variable (reference or constant string)
+		else if (const llvm::GlobalVariable* pGlobal = llvm::dyn_cast<llvm::GlobalVariable>(pValue))
+		{
+			// Copy the global into the new module
+			llvm::GlobalVariable* pNewGlobal = new llvm::GlobalVariable(
+				*pCacheModule,
+				pGlobal->getType()->getElementType(),
+				pGlobal->isConstant(),
+				pGlobal->getLinkage(),
+				pGlobal->hasInitializer()? const_cast<llvm::Constant*>(pGlobal->getInitializer()):NULL,
+				pGlobal->getName()
+			);
+			pNewGlobal->setUnnamedAddr(pGlobal->hasUnnamedAddr());
+			pNewGlobal->setAlignment(pGlobal->getAlignment());
+			valueMap[pGlobal] = pNewGlobal;
+		}
+		
+		// Other global values cannot be cached
+		else if (llvm::isa<llvm::GlobalValue>(pValue))
+		{
+			storable = false;
+		}
+		
+		// For constant expressions, visit the operands
+		else
+		{
+			const llvm::User* pUser = llvm::cast<llvm::User>(pValue);
+			for (unsigned i = 0; i < pUser->getNumOperands(); ++i)
+				workList.push_back(pUser->getOperand(i));
+		}
+	}
+	
+	// If the function can be stored
+	if (storable)
+	{
+		// Copy the function body into the new module
+		llvm::SmallVector<llvm::ReturnInst*, 8> returns;
+		llvm::CloneFunctionInto(pNewFunc, pFuncObj, valueMap, true, returns);
+		
+		// Write the module bitcode
+		std::string bitcode;
+		llvm::raw_string_ostream bitcodeStream(bitcode);
+		llvm::WriteBitcodeToFile(pCacheModule, bitcodeStream);
+		bitcodeStream.flush();
+		
+		// Write the argument object types
+		std::string inObjTypes;
+		std::string outObjTypes;
+		for (size_t i = 0; i < version.inArgObjTypes.size(); ++i)
+			inObjTypes += ::toString((int)version.inArgObjTypes[i]) + " ";
+		for (size_t i = 0; i < version.outArgObjTypes.size(); ++i)
+			outObjTypes += ::toString((int)version.outArgObjTypes[i]) + " ";
+		
+		// Store the cache entry sections
+		CodeCache::SectionVector sections;
+		sections.push_back(version.cacheRefs);
+		sections.push_back(version.cacheDeps);
+		sections.push_back(inObjTypes);
+		sections.push_back(outObjTypes);
+		sections.push_back(bitcode);
+		CodeCache::store(version.cacheKey, sections);
+	}
+	
+	// Delete the temporary module
+	delete pCacheModule;
+	
+	// Return whether the version was stored
+	return storable;
+}
+
+/***************************************************************
+* Function: JITCompiler::recordVersionRef()
+* Purpose : Record a direct call to another function version
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::recordVersionRef(ProgFunction* pCallee, const CompVersion& calleeVersion, const CompVersion& callerVersion)
+{
+	// If the caller is not being cached, or if this is a call to the caller itself, do nothing
+	if (s_pCacheBuild == NULL || s_pCacheBuild->cacheable == false || &calleeVersion == &callerVersion)
+		return;
+	
+	// If the callee version is already referenced, do nothing
+	if (s_pCacheBuild->refGlobals.find(calleeVersion.pLLVMFunc) != s_pCacheBuild->refGlobals.end())
+		return;
+	
+	// Get the local environment of the caller
+	Environment* pLocalEnv = ProgFunction::getLocalEnv(s_pCacheBuild->pFunction);
+	
+	// The callee must be bound to its name, and its argument types must be writable
+	std::string typeText;
+	if (Environment::lookup(pLocalEnv, SymbolExpr::getSymbol(pCallee->getFuncName())) != (DataObject*)pCallee ||
+		writeTypeSetStr(calleeVersion.inArgTypes, pLocalEnv, typeText) == false)
+	{
+		s_pCacheBuild->cacheable = false;
+		return;
+	}
+	
+	// Add the callee version to the reference table, under the name of its LLVM function
+	s_pCacheBuild->refTable += calleeVersion.pLLVMFunc->getName().str() + " V " + pCallee->getFuncName() + " " + typeText + "\n";
+	s_pCacheBuild->refGlobals[calleeVersion.pLLVMFunc] = calleeVersion.pLLVMFunc;
+}
+
+/***************************************************************
+* Function: JITCompiler::writeTypeSetStr()
+* Purpose : Write a type set string as text
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::writeTypeSetStr(const TypeSetString& typeSetStr, Environment* pEnv, std::string& text)
+{
+	// Write the number of type sets
+	text += ::toString(typeSetStr.size());
+	
+	// For each type set
+	for (size_t i = 0; i < typeSetStr.size(); ++i)
+	{
+		// Write the number of types in the set
+		text += " " + ::toString(typeSetStr[i].size());
+		
+		// Write each type of the set
+		for (TypeSet::const_iterator itr = typeSetStr[i].begin(); itr != typeSetStr[i].end(); ++itr)
+			if (writeTypeInfo(*itr, pEnv, text) == false)
+				return false;
+	}
+	
+	// The type set string was written
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::writeTypeInfo()
+* Purpose : Write type information as text
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::writeTypeInfo(const TypeInfo& type, Environment* pEnv, std::string& text)
+{
+	// Write the object type and the flags
+	text += " " + ::toString((int)type.getObjType());
+	text += type.is2D()? " 1":" 0";
+	text += type.isScalar()? " 1":" 0";
+	text += type.isInteger()? " 1":" 0";
+	text += type.getSizeKnown()? " 1":" 0";
+	
+	// Write the matrix size
+	const TypeInfo::DimVector& matSize = type.getMatSize();
+	text += " " + ::toString(matSize.size());
+	for (size_t i = 0; i < matSize.size(); ++i)
+		text += " " + ::toString(matSize[i]);
+	
+	// If there is a function, it must be bound to its name
+	Function* pFunction = type.getFunction();
+	if (pFunction != NULL)
+	{
+		if (pFunction->getFuncName().empty() || Environment::lookup(pEnv, SymbolExpr::getSymbol(pFunction->getFuncName())) != (DataObject*)pFunction)
+			return false;
+		text += " " + pFunction->getFuncName();
+	}
+	else
+	{
+		text += " -";
+	}
+	
+	// Write the cell array stored types
+	const std::set<TypeInfo>& cellTypes = type.getCellTypes();
+	text += " " + ::toString(cellTypes.size());
+	for (std::set<TypeInfo>::const_iterator itr = cellTypes.begin(); itr != cellTypes.end(); ++itr)
+		if (writeTypeInfo(*itr, pEnv, text) == false)
+			return false;
+	
+	// The type information was written
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::readTypeSetStr()
+* Purpose : Read a type set string from text
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::readTypeSetStr(std::istream& stream, Environment* pEnv, TypeSetString& typeSetStr)
+{
+	// Read the number of type sets
+	size_t numSets;
+	if (!(stream >> numSets))
+		return false;
+	
+	// For each type set
+	for (size_t i = 0; i < numSets; ++i)
+	{
+		// Read the number of types in the set
+		size_t numTypes;
+		if (!(stream >> numTypes))
+			return false;
+		
+		// Read each type of the set
+		TypeSet typeSet;
+		for (size_t j = 0; j < numTypes; ++j)
+		{
+			TypeInfo type;
+			if (readTypeInfo(stream, pEnv, type) == false)
+				return false;
+			typeSet.insert(type);
+		}
+		
+		// Add the type set to the string
+		typeSetStr.push_back(typeSet);
+	}
+	
+	// The type set string was read
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::readTypeInfo()
+* Purpose : Read type information from text
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::readTypeInfo(std::istream& stream, Environment* pEnv, TypeInfo& type)
+{
+	// Read the object type, the flags and the number of dimensions
+	int objType, is2D, isScalar, isInteger, sizeKnown;
+	size_t numDims;
+	if (!(stream >> objType >> is2D >> isScalar >> isInteger >> sizeKnown >> numDims) || numDims > MAX_CACHED_DIMS)
+		return false;
+	
+	// Read the matrix size
+	TypeInfo::DimVector matSize(numDims);
+	for (size_t i = 0; i < numDims; ++i)
+		if (!(stream >> matSize[i]))
+			return false;
+	
+	// Read the function name
+	std::string funcName;
+	if (!(stream >> funcName))
+		return false;
+	
+	// If there is a function, look it up, loading its file if needed
+	Function* pFunction = NULL;
+	if (funcName != "-")
+	{
+		DataObject* pObject = NULL;
+		try { pObject = Interpreter::evalSymbol(SymbolExpr::getSymbol(funcName), pEnv); }
+		catch (RunError error) {}
+		if (pObject == NULL || pObject->getType() != DataObject::FUNCTION)
+			return false;
+		pFunction = (Function*)pObject;
+	}
+	
+	// Read the cell array stored types
+	size_t numCellTypes;
+	if (!(stream >> numCellTypes))
+		return false;
+	std::set<TypeInfo> cellTypes;
+	for (size_t i = 0; i < numCellTypes; ++i)
+	{
+		TypeInfo cellType;
+		if (readTypeInfo(stream, pEnv, cellType) == false)
+			return false;
+		cellTypes.insert(cellType);
+	}
+	
+	// Build the type information object
+	type = TypeInfo(
+		(DataObject::Type)objType,
+		is2D != 0,
+		isScalar != 0,
+		isInteger != 0,
+		sizeKnown != 0,
+		matSize,
+		pFunction,
+		cellTypes
+	);
+	
+	// The type information was read
+	return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::createObjRef()
+* Purpose : Create a reference to an IIR node or function
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Constant* JITCompiler::createObjRef(const IIRNode* pNode)
+{
+	// If the version is not being cached, embed the pointer directly
+	if (s_pCacheBuild == NULL || s_pCacheBuild->cacheable == false || pNode == NULL)
+		return createPtrConst(pNode);
+	
+	// If the object is already referenced, reuse its reference
+	std::map<const void*, llvm::Constant*>::iterator refItr = s_pCacheBuild->refGlobals.find(pNode);
+	if (refItr != s_pCacheBuild->refGlobals.end())
+		return refItr->second;
+	
+	// Describe how to find the object again in another run
+	std::string refDesc;
+	
+	// If the object is a function
+	if (pNode->getType() == IIRNode::FUNCTION)
+	{
+		// Get a typed pointer to the function
+		const Function* pFunc = (const Function*)pNode;
+		
+		// If this is the function being compiled
+		if (pFunc == s_pCacheBuild->pFunction)
+		{
+			refDesc = "F";
+		}
+		
+		// Otherwise, if the function is bound to its name in the local environment
+		else if (Environment::lookup(ProgFunction::getLocalEnv(s_pCacheBuild->pFunction), SymbolExpr::getSymbol(pFunc->getFuncName())) == (const DataObject*)pFunc)
+		{
+			refDesc = "C " + pFunc->getFuncName();
+		}
+	}
 	
-	// Get a function pointer to the compiled function
-	COMP_FUNC_PTR pFuncPtr = (COMP_FUNC_PTR)s_pExecEngine->getPointerToFunction(pFuncObj);
+	// If the object is a symbol
+	else if (pNode->getType() == IIRNode::EXPRESSION && ((const Expression*)pNode)->getExprType() == Expression::SYMBOL)
+	{
+		refDesc = "S " + ((const SymbolExpr*)pNode)->getSymName();
+	}
 	
-	// Store a pointer to the compiled function code
-	compVersion.pFuncPtr = pFuncPtr;
+	// Otherwise, if the node is part of the function body
+	else if (s_pCacheBuild->nodeIndices.find(pNode) != s_pCacheBuild->nodeIndices.end())
+	{
+		refDesc = "N " + ::toString(s_pCacheBuild->nodeIndices[pNode]);
+	}
 	
-	// If we are in verbose mode
-	if (ConfigManager::s_verboseVar)
+	// If the object cannot be found again, the version is not cached
+	if (refDesc.empty())
 	{
-		// Log that compilation is complete
-		std::cout << "Compilation complete" << std::endl;
-		
-		// Run the pretty-printer pass on the function
-		s_pPrintPass->run(*pFuncObj);
+		s_pCacheBuild->cacheable = false;
+		return createPtrConst(pNode);
 	}
 	
-	PROF_STOP_TIMER(Profiler::COMP_TIME_TOTAL);
+	// Create an external global standing for the object, mapped to its address
+	std::string refName = "mcvm.ref." + ::toString(s_cacheNameCount++);
+	llvm::GlobalVariable* pRefVar = new llvm::GlobalVariable(
+		*s_pModule,
+		llvm::Type::getInt8Ty(*s_Context),
+		false,
+		llvm::GlobalValue::ExternalLinkage,
+		NULL,
+		refName
+	);
+	s_pExecEngine->addGlobalMapping(pRefVar, (void*)pNode);
+	
+	// Add the reference to the table
+	s_pCacheBuild->refTable += refName + " " + refDesc + "\n";
+	s_pCacheBuild->refGlobals[pNode] = pRefVar;
+	
+	// Return the reference
+	return pRefVar;
 }
 
 /***************************************************************
@@ -1112,7 +2974,7 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 ****************************************************************
 Revisions and bug fixes:
 */
-ArrayObj* JITCompiler::callFunction(ProgFunction* pFunction, ArrayObj* pArguments, size_t outArgCount)
+ArrayObj* JITCompiler::callFunction(ProgFunction* pFunction, ArrayObj* pArguments, size_t outArgCount, const ParamExpr* pCallSite, bool tiered)
 {
 	// Get a reference to the input parameter vector
 	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
@@ -1128,38 +2990,168 @@ ArrayObj* JITCompiler::callFunction(ProgFunction* pFunction, ArrayObj* pArgument
 	if (outArgCount > outParams.size())
 		throw RunError("too many output arguments");
 
+	// Get the number of arguments
+	size_t numArgs = pArguments->getSize();
+	
+	// Declare a pointer for the call site cache
+	CallSiteCache* pCallCache = NULL;
+	
+	// Declare an array for the argument type tags
+	uint32 argTags[CALL_CACHE_MAX_ARGS];
+	
+	// If the call site is known and call caching is enabled
+	if (pCallSite != NULL && numArgs <= CALL_CACHE_MAX_ARGS && s_jitUseCallCaches.getBoolValue() == true)
+	{
+		// Compute the type tag of each argument
+		bool allTagged = true;
+		for (size_t i = 0; i < numArgs; ++i)
+		{
+			// Compute the tag for this argument
+			argTags[i] = TypeInfo::getTypeTag(pArguments->getObject(i));
+			
+			// If the argument type cannot be tagged, the call is not cacheable
+			if (argTags[i] == 0)
+			{
+				allTagged = false;
+				break;
+			}
+		}
+		
+		// If all the arguments were tagged
+		if (allTagged)
+		{
+			// Get the cache stored on the call site, creating it if needed
+			pCallCache = (CallSiteCache*)pCallSite->getCallCache();
+			if (pCallCache == NULL)
+			{
+				pCallCache = new CallSiteCache();
+				pCallSite->setCallCache(pCallCache);
+			}
+			
+			// For each cached entry
+			for (size_t i = 0; i < pCallCache->numEntries; ++i)
+			{
+				// Get a reference to this entry
+				const CallCacheEntry& entry = pCallCache->entries[i];
+				
+				// If the function and argument types match
+				if (entry.pFunction == pFunction && entry.numArgs == numArgs &&
+					memcmp(entry.argTags, argTags, numArgs * sizeof(uint32)) == 0)
+				{
+					// Call the cached wrapper function directly
+					PROF_INCR_COUNTER(Profiler::CALL_CACHE_HIT_COUNT);
+					return entry.pWrapperPtr(pArguments, outArgCount);
+				}
+			}
+			
+			// The call site cache missed
+			PROF_INCR_COUNTER(Profiler::CALL_CACHE_MISS_COUNT);
+		}
+	}
+
 	// Build a type set string from the arguments
 	TypeSetString argTypeStr = typeSetStrMake(pArguments);
-		
-	// Attempt to find the function in the function map
-	FunctionMap::iterator funcItr = s_functionMap.find(pFunction);
 	
-	// If the version of this function is not yet compiled
-	if (funcItr == s_functionMap.end() || funcItr->second.versions.find(argTypeStr) == funcItr->second.versions.end())
+	// Attempt to find the version of this function matching the argument types
+	// NOTE: the function and version maps are only modified by this thread
+	CompVersion* pVersion = NULL;
+	FunctionMap::iterator funcItr = s_functionMap.find(pFunction);
+	if (funcItr != s_functionMap.end())
 	{
-		// Compile the requested function version
-		compileFunction(pFunction, argTypeStr);
+		VersionMap::iterator versionItr = funcItr->second.versions.find(argTypeStr);
+		if (versionItr != funcItr->second.versions.end())
+			pVersion = &versionItr->second;
 	}
 	
-	// Find the compiled function object
-	funcItr = s_functionMap.find(pFunction);
-	assert (funcItr != s_functionMap.end());
-	
-	// Get a reference to the compiled function object
-	CompFunction& compFunction = funcItr->second;
+	// If the call may be interpreted and the version is not yet compiled
+	if (tiered == true && pVersion == NULL)
+	{
+		// Get the number of interpreted calls of this version
+		size_t& callCount = s_hotCountMap[HotCountKey(pFunction, argTypeStr)];
+		
+		// If the version is not yet hot, interpret this call
+		if (callCount < (size_t)s_jitHotThresholdVar.getIntValue())
+		{
+			++callCount;
+			return NULL;
+		}
+		
+		// The version is compiled, its count is no longer needed
+		s_hotCountMap.erase(HotCountKey(pFunction, argTypeStr));
+	}
 	
-	// Find a version of this function matching the argument types
-	VersionMap::iterator versionItr = compFunction.versions.find(argTypeStr);
-	assert (versionItr != compFunction.versions.end());
+	// If the version or its call wrapper is not ready to run
+	if (pVersion == NULL || pVersion->pWrapperPtr == NULL)
+	{
+		// If the version's code is still being generated in the background, interpret this call
+		if (tiered == true && pVersion != NULL && __atomic_load_n(&pVersion->pFuncPtr, __ATOMIC_ACQUIRE) == NULL)
+			return NULL;
+		
+		// Lock the LLVM state, calls that may be interpreted do
+		// not wait for the background thread to release it
+		std::unique_lock<std::recursive_mutex> lock(s_compMutex, std::defer_lock);
+		if (tiered == true && s_pCompThread != NULL)
+		{
+			if (lock.try_lock() == false)
+				return NULL;
+		}
+		else
+		{
+			lock.lock();
+		}
+		
+		// If the version of this function is not yet compiled
+		if (pVersion == NULL)
+		{
+			// Compile the requested function version, in the background if enabled
+			compileFunction(pFunction, argTypeStr, tiered == true && s_jitBackgroundVar.getBoolValue() == true);
+			
+			// Find the compiled function object
+			funcItr = s_functionMap.find(pFunction);
+			assert (funcItr != s_functionMap.end());
+			
+			// Find the version of this function matching the argument types
+			VersionMap::iterator versionItr = funcItr->second.versions.find(argTypeStr);
+			assert (versionItr != funcItr->second.versions.end());
+			pVersion = &versionItr->second;
+		}
+		
+		// If the version's code is queued for generation
+		if (pVersion->pFuncPtr == NULL)
+		{
+			// Calls that may be interpreted do so until the code is ready
+			if (tiered == true)
+				return NULL;
+			
+			// Otherwise, generate the code now
+			finishPendingVersion(*pVersion);
+		}
+		
+		// If there is no call wrapper function available
+		if (pVersion->pWrapperPtr == NULL)
+		{
+			// Compile a wrapper function for the function version
+			compWrapperFunc(funcItr->second, *pVersion);
+		}
+	}
 	
 	// Get a reference to the compiled function version
-	CompVersion& compVersion = versionItr->second;
+	CompVersion& compVersion = *pVersion;
 	
-	// If there is no call wrapper function available
-	if (compVersion.pWrapperPtr == NULL)
+	// If the call can be cached at this call site
+	if (pCallCache != NULL)
 	{
-		// Compile a wrapper function for the function version
-		compWrapperFunc(compFunction, compVersion);
+		// Fill the next free entry, or replace the oldest one
+		size_t entryIndex = pCallCache->nextEntry;
+		pCallCache->nextEntry = (entryIndex + 1) % CALL_CACHE_ENTRIES;
+		pCallCache->numEntries = std::max(pCallCache->numEntries, entryIndex + 1);
+		
+		// Store the function, argument types and wrapper in the entry
+		CallCacheEntry& entry = pCallCache->entries[entryIndex];
+		entry.pFunction = pFunction;
+		entry.numArgs = numArgs;
+		memcpy(entry.argTags, argTags, numArgs * sizeof(uint32));
+		entry.pWrapperPtr = compVersion.pWrapperPtr;
 	}
 	
 	// Call the wrapper function with the input arguments
@@ -1223,7 +3215,7 @@ llvm::Value* JITCompiler::getCallEnv(
 		llvm::Value* pLocalEnvPtr = createNativeCall(
 			irBuilder,
 			(void*)ProgFunction::getLocalEnv,
-			LLVMValueVector(1, createPtrConst(function.pProgFunc))
+			LLVMValueVector(1, createObjRef(function.pProgFunc))
 		);		
 
 		// If the function is a script
@@ -1634,7 +3626,7 @@ void JITCompiler::writeVariable(
 	// Setup thje call arguments 
 	LLVMValueVector bindArgs;
 	bindArgs.push_back(pEnvObj);
-	bindArgs.push_back(createPtrConst(pSymbol));
+	bindArgs.push_back(createObjRef(pSymbol));
 	bindArgs.push_back(pValue);
 	
 	// Create the call to bind the variable in the function's environment 
@@ -1709,7 +3701,7 @@ JITCompiler::Value JITCompiler::readVariable(
 	llvm::Value* pEnvObj = getCallEnv(function, version);
 
 	// Create a pointer constant for the symbol argument
-	llvm::Value* pSymArg = createPtrConst(pSymbol);
+	llvm::Value* pSymArg = createObjRef(pSymbol);
 	
 	// Declare a pointer for the value read
 	llvm::Value* pReadValue;
@@ -2464,7 +4456,8 @@ void JITCompiler::compWrapperFunc(
 		std::cout << "Compiling wrapper for function: \"" << pFunction->getFuncName() << "\"" << std::endl;
 	
 	// Create a name string for the function
-	std::string funcName = pFunction->getFuncName() + "_wrapper_" + ::toString((void*)version.pTypeInferInfo);
+	// NOTE: versions loaded from the code cache have no type inference information
+	std::string funcName = pFunction->getFuncName() + "_wrapper_" + ::toString((void*)version.pLLVMFunc);
 	
 	// Get a function type object with the appropriate signature
 	LLVMTypeVector argTypes;
@@ -2676,7 +4669,7 @@ void JITCompiler::compWrapperFunc(
 	}
 	
 	// Run the optimization passes on the function
-	s_pFunctionPasses->run(*pFuncObj);
+	runOptPasses(pFuncObj);
 	
 	// Get a function pointer to the compiled function
 	WRAPPER_FUNC_PTR pFuncPtr = (WRAPPER_FUNC_PTR)s_pExecEngine->getPointerToFunction(pFuncObj);
@@ -3154,7 +5147,7 @@ llvm::BasicBlock* JITCompiler::compStatement(
 			llvm::Value* pEnvObject = getCallEnv(function, version);			
 			
 			// Create an llvm pointer constant for the statement pointer
-			llvm::Value* pStmtPtr = createPtrConst(pStatement);
+			llvm::Value* pStmtPtr = createObjRef(pStatement);
 			
 			// Get the function object for the "execStatement" function
 			const NativeFunc& execStmtFunc = s_nativeMap[(void*)Interpreter::execStatement];
@@ -3284,7 +5277,7 @@ llvm::BasicBlock* JITCompiler::compExprStmt(
 	llvm::Value* pEnvArg = getCallEnv(function, version);
 	
 	// Create an llvm pointer constant for the statement pointer
-	llvm::Value* pStmtPtr = createPtrConst(pExprStmt);
+	llvm::Value* pStmtPtr = createObjRef(pExprStmt);
 		
 	// Create a basic block for the statement
 	llvm::BasicBlock* pStmtBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
@@ -3334,7 +5327,7 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
 		
 		// Create a call to execute this statement
 		LLVMValueVector callArgs;
-		callArgs.push_back(createPtrConst(pAssignStmt));
+		callArgs.push_back(createObjRef(pAssignStmt));
 		callArgs.push_back(getCallEnv(function, version));
 		createNativeCall(
 			builder,
@@ -3673,7 +5666,7 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
 				
 				// Create a call to perform the object assignment
 				LLVMValueVector assignArgs;
-				assignArgs.push_back(createPtrConst(pLeftExpr));
+				assignArgs.push_back(createObjRef(pLeftExpr));
 				assignArgs.push_back(pRightObject);
 				assignArgs.push_back(getCallEnv(function, version));
 				assignArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt8Ty(*s_Context), 0));
@@ -3701,7 +5694,7 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
 			
 			// Create a call to perform the object assignment
 			LLVMValueVector assignArgs;
-			assignArgs.push_back(createPtrConst(pLeftExpr));
+			assignArgs.push_back(createObjRef(pLeftExpr));
 			assignArgs.push_back(pRightObject);
 			assignArgs.push_back(getCallEnv(function, version));
 			assignArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt8Ty(*s_Context), 0));
@@ -4476,6 +6469,15 @@ JITCompiler::Value JITCompiler::compUnaryExpr(
 	llvm::BasicBlock* pExitBlock
 )
 {
+	// If this is the root of a fused element-wise expression tree
+	FusedArrayOp* pFusedOp = getFusedArrayOp(pUnaryExpr, version);
+	if (pFusedOp != NULL)
+	{
+		// Compile the tree as a single fused operation
+		return compFusedArrayOp(pFusedOp, function, version, liveVars,
+			reachDefs, varTypes, varMap, pEntryBlock, pExitBlock);
+	}
+	
 	// Switch on the binary operator type
 	switch (pUnaryExpr->getOperator())
 	{
@@ -4565,6 +6567,15 @@ JITCompiler::Value JITCompiler::compBinaryExpr(
 		);
 	}
 	
+	// If this is the root of a fused element-wise expression tree
+	FusedArrayOp* pFusedOp = getFusedArrayOp(pBinaryExpr, version);
+	if (pFusedOp != NULL)
+	{
+		// Compile the tree as a single fused operation
+		return compFusedArrayOp(pFusedOp, function, version, liveVars,
+			reachDefs, varTypes, varMap, pEntryBlock, pExitBlock);
+	}
+	
 	// Switch on the binary operator type
 	switch (pBinaryExpr->getOperator())
 	{
@@ -5121,6 +7132,125 @@ JITCompiler::Value JITCompiler::compBinaryExpr(
 	}
 }
 
+/***************************************************************
+* Function: JITCompiler::getFusedArrayOp()
+* Purpose : Get the fused operation to use for an expression
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+FusedArrayOp* JITCompiler::getFusedArrayOp(
+	const Expression* pExpr,
+	CompVersion& version
+)
+{
+	// If expression fusion is disabled or this is not an element-wise operation, do not fuse
+	if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == false || FusedArrayOp::isFusableOp(pExpr) == false)
+		return NULL;
+	
+	// Find the type set for this expression
+	ExprTypeMap::const_iterator typeItr = version.pTypeInferInfo->exprTypeMap.find(pExpr);
+	
+	// If no type information is available, do not fuse
+	if (typeItr == version.pTypeInferInfo->exprTypeMap.end() || typeItr->second.size() != 1 || typeItr->second[0].empty())
+		return NULL;
+	
+	// Get the possible types of the expression
+	const TypeSet& exprTypes = typeItr->second[0];
+	
+	// For each possible type
+	for (TypeSet::const_iterator itr = exprTypes.begin(); itr != exprTypes.end(); ++itr)
+	{
+		// If the result may be a scalar or not a 64-bit float matrix, the
+		// scalar code generated for the individual operations is preferable
+		if (itr->getObjType() != DataObject::MATRIX_F64 || itr->isScalar())
+			return NULL;
+	}
+	
+	// Get the fused operation for this expression tree
+	return FusedArrayOp::getFusedOp(pExpr);
+}
+
+/***************************************************************
+* Function: JITCompiler::compFusedArrayOp()
+* Purpose : Compile a fused element-wise expression tree
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+JITCompiler::Value JITCompiler::compFusedArrayOp(
+	FusedArrayOp* pFusedOp,
+	CompFunction& function,
+	CompVersion& version,
+	const Expression::SymbolSet& liveVars,
+	const VarDefMap& reachDefs,
+	const VarTypeMap& varTypes,
+	VariableMap& varMap,
+	llvm::BasicBlock* pEntryBlock,
+	llvm::BasicBlock* pExitBlock
+)
+{
+	// Get the leaf operand expressions
+	const Expression::ExprVector& leaves = pFusedOp->getLeaves();
+	
+	// Create an IR builder for the current basic block
+	llvm::IRBuilder<> currentBuilder(pEntryBlock);
+	
+	// Create an array object to store the leaf values
+	llvm::Value* pLeafArray = createNativeCall(
+		currentBuilder,
+		(void*)ArrayObj::create,
+		LLVMValueVector(1, llvm::ConstantInt::get(getIntType(sizeof(size_t)), leaves.size()))
+	);
+	
+	// For each leaf operand, in evaluation order
+	for (Expression::ExprVector::const_iterator leafItr = leaves.begin(); leafItr != leaves.end(); ++leafItr)
+	{
+		// Create basic blocks for the expression compilation
+		llvm::BasicBlock* pLeafEntryBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+		llvm::BasicBlock* pLeafExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+		
+		// Compile the expression to get the leaf value
+		Value leafValue = compExpression(*leafItr, function, version, liveVars,
+				reachDefs, varTypes, varMap, pLeafEntryBlock, pLeafExitBlock);
+		
+		// Jump to the entry block
+		currentBuilder.CreateBr(pLeafEntryBlock);
+		
+		// Update the current IR builder
+		currentBuilder.SetInsertPoint(pLeafExitBlock);
+		
+		// Store the leaf value as an object pointer
+		llvm::Value* pLeafObj = changeStorageMode(currentBuilder, leafValue.pValue, leafValue.objType, VOID_PTR_TYPE);
+		
+		// Add the leaf value to the leaf array object
+		LLVMValueVector addArgs;
+		addArgs.push_back(pLeafArray);
+		addArgs.push_back(pLeafObj);
+		createNativeCall(
+			currentBuilder,
+			(void*)ArrayObj::addObject,
+			addArgs
+		);
+	}
+	
+	// Evaluate all the operations of the tree in a single pass
+	LLVMValueVector evalArgs;
+	evalArgs.push_back(createPtrConst(pFusedOp));
+	evalArgs.push_back(pLeafArray);
+	llvm::Value* pResultObj = createNativeCall(
+		currentBuilder,
+		(void*)FusedArrayOp::evalLeaves,
+		evalArgs
+	);
+	
+	// Branch to the exit block
+	currentBuilder.CreateBr(pExitBlock);
+	
+	// Return the result object
+	return Value(pResultObj, DataObject::MATRIX_F64);
+}
+
 /***************************************************************
 * Function: JITCompiler::compBinaryOp()
 * Purpose : Generate code for binary expression operations
@@ -6296,7 +8426,7 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(Function* pCalleeFunc,
 			
 			// Set the callee's local environment as the current call environment
 			LLVMValueVector setArgs;
-			setArgs.push_back(createPtrConst(pCalleeFunc));
+			setArgs.push_back(createObjRef(pCalleeFunc));
 			setArgs.push_back(getCallEnv(callerFunction, callerVersion));
 			createNativeCall(
 				currentBuilder,
@@ -6448,7 +8578,7 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(Function* pCalleeFunc,
 				
 				// Create a native call to evaluate the expresssion
 				LLVMValueVector evalArgs;
-				evalArgs.push_back(createPtrConst(pArgExpr));
+				evalArgs.push_back(createObjRef(pArgExpr));
 				evalArgs.push_back(getCallEnv(callerFunction, callerVersion));
 				llvm::Value* pArgValue = createNativeCall(currentBuilder,
 					(void*)Interpreter::evalCellIndexExpr,
@@ -6499,9 +8629,10 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(Function* pCalleeFunc,
 		
 		// Perform the function call
 		LLVMValueVector callArgs;
-		callArgs.push_back(createPtrConst(pCalleeFunc));
+		callArgs.push_back(createObjRef(pCalleeFunc));
 		callArgs.push_back(pInArray);
 		callArgs.push_back(pOutArgCount);
+		callArgs.push_back(createObjRef(pOrigExpr));
 		llvm::Value* pOutArray = createNativeCall(
 			currentBuilder,
 			(void*)Interpreter::callFunction,
@@ -6609,6 +8740,11 @@ void JITCompiler::compFuncCallJIT(
 	// Get a reference to the compiled function version
 	CompVersion& calleeVersion = versionItr->second;
 	
+	// If the callee's code is queued for generation, generate it now so
+	// that it is optimized before the caller's code references it
+	if (calleeVersion.pFuncPtr == NULL)
+		finishPendingVersion(calleeVersion);
+	
 	// Get the call input/output structures
 	LLVMValuePair callStructs = getCallStructs(callerFunction, callerVersion, calleeFunction, calleeVersion);
 	
@@ -6684,6 +8820,9 @@ void JITCompiler::compFuncCallJIT(
 	// If this is a recursive call, and thus the function is not yet compiled
 	if (calleeFunction.pProgFunc == pProgFunc)
 	{
+		// Record how to find the callee version again, for the code cache
+		recordVersionRef(pProgFunc, calleeVersion, callerVersion);
+		
 		// Create a direct call to the function
 		LLVMValueVector callArgs;
 		callArgs.push_back(pInStructPtr);
@@ -6694,7 +8833,7 @@ void JITCompiler::compFuncCallJIT(
 	{
 		// Create a native call through the exception handler
 		LLVMValueVector callArgs;
-		callArgs.push_back(createPtrConst(pProgFunc));
+		callArgs.push_back(createObjRef(pProgFunc));
 		callArgs.push_back(createPtrConst((void*)calleeVersion.pFuncPtr));
 		callArgs.push_back(callerVersion.pInStruct);
 		callArgs.push_back(callerVersion.pOutStruct);
@@ -6978,7 +9117,7 @@ JITCompiler::Value JITCompiler::compSymbolEval(
 		{
 			// Create a native call to evaluate the symbol
 			LLVMValueVector evalArgs;
-			evalArgs.push_back(createPtrConst(pSymbolExpr));
+			evalArgs.push_back(createObjRef(pSymbolExpr));
 			evalArgs.push_back(getCallEnv(function, version));
 			llvm::Value* pValue = createNativeCall(
 				entryBuilder,
@@ -7025,12 +9164,8 @@ JITCompiler::Value JITCompiler::compArrayRead(
 	// If there is more than one index
 	if (indices.size() > 1)
 	{
-		// Get a pointer to the dimension size array
-		pSizeArrayPtr = createNativeCall(
-			currentBuilder,
-			(void*)BaseMatrixObj::getSizeArray,
-			LLVMValueVector(1, pMatrixObj)
-		);
+		// Load the dimension size array pointer directly
+		pSizeArrayPtr = loadSizeArray(currentBuilder, pMatrixObj);
 	}
 	
 	// Declare a value vector for the zero-indexing indices
@@ -7066,12 +9201,8 @@ JITCompiler::Value JITCompiler::compArrayRead(
 	// If we are indexing in more than 2 dimensions and bounds checking is required
 	if (indices.size() > 2 && s_jitNoReadBoundChecks == false)
 	{
-		// Get the number of matrix dimensions
-		pNumDims = createNativeCall(
-			currentBuilder,
-			(void*)BaseMatrixObj::getDimCount,
-			LLVMValueVector(1, pMatrixObj)
-		);
+		// Load the number of matrix dimensions directly
+		pNumDims = loadDimCount(currentBuilder, pMatrixObj);
 		
 		// Test if there are more indices than matrix dimensions
 		llvm::Value* pCompVal = currentBuilder.CreateICmpULT(
@@ -7083,7 +9214,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
 		);
 		
 		// Branch based on the test condition
-		currentBuilder.CreateCondBr(pCompVal, pTMIBlock, pNMIBlock);
+		currentBuilder.CreateCondBr(pCompVal, pTMIBlock, pNMIBlock, getColdBranchWeights());
 	}
 	else
 	{
@@ -7261,7 +9392,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
 			llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 			
 			// Branch based on the test condition
-			currentBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock);
+			currentBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock, getColdBranchWeights());
 			
 			// Update the current basic block
 			currentBuilder.SetInsertPoint(pPassBlock);
@@ -7288,7 +9419,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
 			llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 			
 			// Branch based on the test condition
-			currentBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock);
+			currentBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock, getColdBranchWeights());
 			
 			// Update the current basic block
 			currentBuilder.SetInsertPoint(pPassBlock);
@@ -7412,20 +9543,8 @@ void JITCompiler::compArrayWrite(
 	// If there is more than one index
 	if (indices.size() > 1)
 	{
-		// Get a pointer to the dimension size array
-		/*pSizeArrayPtr = createNativeCall(
-			currentBuilder,
-			(void*)BaseMatrixObj::getSizeArray,
-			LLVMValueVector(1, pMatrixObj)
-		);*/
-		//RAHUL: Changed to more efficient that avoids function call
-		unsigned int offset = MEMBER_OFFSET(BaseMatrixObj,m_size)+MEMBER_OFFSET(DimVector,m_ptr);
-		llvm::Value* intPtrMatrixObj = currentBuilder.CreatePtrToInt(pMatrixObj,getIntType(8),"inttoptr");
-		llvm::Value* intPtrSizeArrayPtr = currentBuilder.CreateAdd(intPtrMatrixObj,llvm::ConstantInt::get(getIntType(8),offset));
-		llvm::Value* pPtrSizeArrayPtr = currentBuilder.CreateIntToPtr(intPtrSizeArrayPtr,llvm::PointerType::getUnqual(llvm::PointerType::getUnqual(getIntType(sizeof(size_t)))),"ptrtoint");
-		pSizeArrayPtr = currentBuilder.CreateLoad(pPtrSizeArrayPtr);
-
-
+		// Load the dimension size array pointer directly
+		pSizeArrayPtr = loadSizeArray(currentBuilder, pMatrixObj);
 	}
 	
 	// Declare a value vector for the zero-indexing indices
@@ -7448,12 +9567,8 @@ void JITCompiler::compArrayWrite(
 	// If we are indexing in more than 2 dimensions and bounds checking is required
 	if (indices.size() > 2 && s_jitNoWriteBoundChecks == false)
 	{
-		// Get the number of matrix dimensions
-		llvm::Value* pNumDims = createNativeCall(
-			currentBuilder,
-			(void*)BaseMatrixObj::getDimCount,
-			LLVMValueVector(1, pMatrixObj)
-		);
+		// Load the number of matrix dimensions directly
+		llvm::Value* pNumDims = loadDimCount(currentBuilder, pMatrixObj);
 		
 		// Test if there are more indices than matrix dimensions
 		llvm::Value* pCompVal = currentBuilder.CreateICmpULT(
@@ -7468,7 +9583,7 @@ void JITCompiler::compArrayWrite(
 		llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 		
 		// Branch based on the test condition
-		currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock);
+		currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock, getColdBranchWeights());
 		
 		// Update the current basic block
 		currentBuilder.SetInsertPoint(pPassBlock);
@@ -7492,12 +9607,8 @@ void JITCompiler::compArrayWrite(
 	// If we are indexing in more than 2 dimensions and bounds checking is required
 	if (indices.size() > 2 && s_jitNoReadBoundChecks == false)
 	{
-		// Get the number of matrix dimensions
-		pNumDims = createNativeCall(
-			currentBuilder,
-			(void*)BaseMatrixObj::getDimCount,
-			LLVMValueVector(1, pMatrixObj)
-		);
+		// Load the number of matrix dimensions directly
+		pNumDims = loadDimCount(currentBuilder, pMatrixObj);
 		
 		// Test if there are more indices than matrix dimensions
 		llvm::Value* pCompVal = currentBuilder.CreateICmpULT(
@@ -7509,7 +9620,7 @@ void JITCompiler::compArrayWrite(
 		);
 		
 		// Branch based on the test condition
-		currentBuilder.CreateCondBr(pCompVal, pTMIBlock, pNMIBlock);
+		currentBuilder.CreateCondBr(pCompVal, pTMIBlock, pNMIBlock, getColdBranchWeights());
 	}
 	else
 	{
@@ -7671,7 +9782,7 @@ void JITCompiler::compArrayWrite(
 			llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);		
 			
 			// Branch based on the test condition
-			currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock);
+			currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock, getColdBranchWeights());
 					
 			// Update the current basic block
 			currentBuilder.SetInsertPoint(pPassBlock);
@@ -7698,7 +9809,7 @@ void JITCompiler::compArrayWrite(
 			llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 			
 			// Branch based on the test condition
-			currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock);
+			currentBuilder.CreateCondBr(pCompVal, pOutBlock, pPassBlock, getColdBranchWeights());
 			
 			// Update the current basic block
 			currentBuilder.SetInsertPoint(pPassBlock);
@@ -7724,14 +9835,14 @@ void JITCompiler::compArrayWrite(
 			// Get the index along the current dimension
 			llvm::Value* pDimIndex = zeroIndices[i];
 						
-			// Test if the index data is out of bounds
-			llvm::Value* pCompVal = outBuilder.CreateICmpSLE(pDimIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 0));
+			// Test if the index is negative (one-based index below 1)
+			llvm::Value* pCompVal = outBuilder.CreateICmpSLT(pDimIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 0));
 			
 			// Create a basic block for the positive case
 			llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 			
 			// Branch based on the test condition
-			outBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock);
+			outBuilder.CreateCondBr(pCompVal, pFailBlock, pPassBlock, getColdBranchWeights());
 			
 			// Update the current out of bounds basic block
 			outBuilder.SetInsertPoint(pPassBlock);
@@ -7774,11 +9885,16 @@ void JITCompiler::compArrayWrite(
 		// Clear the matrix dimensions
 		dimSizes.clear();
 		
+		// Reload the size array pointer, as the expansion may have moved it
+		llvm::Value* pNewSizeArrayPtr = NULL;
+		if (indices.size() > 1)
+			pNewSizeArrayPtr = loadSizeArray(outBuilder, pMatrixObj);
+		
 		// For each index (except the last)
 		for (size_t i = 0; i < indices.size() - 1; ++i)
 		{
 			// Extract the size of the current dimension
-			llvm::Value* pDimElemPtr = outBuilder.CreateGEP(pSizeArrayPtr, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
+			llvm::Value* pDimElemPtr = outBuilder.CreateGEP(pNewSizeArrayPtr, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
 			llvm::Value* pDimSize = outBuilder.CreateLoad(pDimElemPtr);
 			pDimSize = outBuilder.CreateIntCast(pDimSize, llvm::Type::getInt64Ty(*s_Context), false);		
 			
@@ -7840,12 +9956,91 @@ void JITCompiler::compArrayWrite(
 	
 	//std::cout << "Bounds checking complete" << std::endl;
 
+	// Declare variables for the shared flag offset and the unshare function
+	size_t sharedOffset;
+	void* pUnshareFunc;
+	
+	// Switch based on the matrix type
+	switch (matrixType)
+	{
+		// Floating-point matrix
+		case DataObject::MATRIX_F64:
+		{
+			// Get the shared flag offset and the unshare function
+			sharedOffset = MEMBER_OFFSET(MatrixF64Obj, m_shared);
+			pUnshareFunc = (void*)MatrixF64Obj::unshareMatrix;
+		}
+		break;
+		
+		// Character array
+		case DataObject::CHARARRAY:
+		{
+			// Get the shared flag offset and the unshare function
+			sharedOffset = MEMBER_OFFSET(CharArrayObj, m_shared);
+			pUnshareFunc = (void*)CharArrayObj::unshareMatrix;
+		}
+		break;
+		
+		// Logical array
+		case DataObject::LOGICALARRAY:
+		{
+			// Get the shared flag offset and the unshare function
+			sharedOffset = MEMBER_OFFSET(LogicalArrayObj, m_shared);
+			pUnshareFunc = (void*)LogicalArrayObj::unshareMatrix;
+		}
+		break;
+		
+		// For any other matrix type
+		default:
+		{
+			// Throw a compilation error
+			throw CompError("unsupported matrix type in scalar write \"" + DataObject::getTypeName(matrixType) + "\"");
+		}
+	}
+	
+	// Load the shared elements flag
+	llvm::Value* pSharedFlag = loadMemberValue(
+		currentBuilder,
+		pMatrixObj,
+		sharedOffset,
+		getIntType(sizeof(bool))
+	);
+	
+	// Test if the matrix elements are shared with another matrix
+	llvm::Value* pIsShared = currentBuilder.CreateICmpNE(
+		pSharedFlag,
+		llvm::ConstantInt::get(getIntType(sizeof(bool)), 0)
+	);
+	
+	// Create basic blocks for the copy-on-write and the write cases
+	llvm::BasicBlock* pUnshareBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+	llvm::BasicBlock* pWriteBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+	
+	// Branch based on the test condition
+	currentBuilder.CreateCondBr(pIsShared, pUnshareBlock, pWriteBlock);
+	
+	// Copy the shared elements before writing
+	llvm::IRBuilder<> unshareBuilder(pUnshareBlock);
+	createNativeCall(unshareBuilder, pUnshareFunc, LLVMValueVector(1, pMatrixObj));
+	unshareBuilder.CreateBr(pWriteBlock);
+	
+	// Make the write block the new current basic block
+	currentBuilder.SetInsertPoint(pWriteBlock);
+
 	// Switch based on the matrix type
 	switch (matrixType)
 	{
 		// Floating-point matrix
 		case DataObject::MATRIX_F64:
 		{
+			// Reset the cached all-integer flag of the matrix
+			storeMemberValue(
+				currentBuilder,
+				pMatrixObj,
+				MEMBER_OFFSET(MatrixF64Obj, m_intFlag),
+				llvm::ConstantInt::get(getIntType(sizeof(char)), MatrixF64Obj::INT_UNKNOWN)
+			);
+			
 			// Load the element array pointer
 			llvm::Value* pDataPtr = loadMemberValue(
 				currentBuilder,
@@ -7975,7 +10170,7 @@ JITCompiler::ValueVector JITCompiler::arrayExprFallback(
 	
 	// Create a native call to evaluate the expresssion
 	LLVMValueVector evalArgs;
-	evalArgs.push_back(createPtrConst(pExpression));
+	evalArgs.push_back(createObjRef(pExpression));
 	evalArgs.push_back(getCallEnv(function, version));
 	evalArgs.push_back(llvm::ConstantInt::get(getIntType(sizeof(size_t)), nargout));
 	llvm::Value* pValue = createNativeCall(
@@ -8134,7 +10329,7 @@ JITCompiler::Value JITCompiler::exprFallback(
 	
 	// Generate the arguments for the native call
 	LLVMValueVector evalArgs;
-	evalArgs.push_back(createPtrConst(pExpression));
+	evalArgs.push_back(createObjRef(pExpression));
 	evalArgs.push_back(getCallEnv(function, version));
 	
 	// Call the interpreter function
@@ -8297,8 +10492,12 @@ void JITCompiler::createThrowError(
 	LLVMValueVector arguments;
 	
 	// Add the text buffer pointer and the IIR node pointer to the arguments
-	arguments.push_back(createPtrConst(pErrorText));
-	arguments.push_back(createPtrConst(pErrorNode));
+	// NOTE: cached code carries its own copy of the error text
+	if (s_pCacheBuild != NULL && s_pCacheBuild->cacheable)
+		arguments.push_back(irBuilder.CreateGlobalStringPtr(pErrorText));
+	else
+		arguments.push_back(createPtrConst(pErrorText));
+	arguments.push_back(createObjRef(pErrorNode));
 	
 	// Create the native call to throw the exception
 	createNativeCall(
@@ -8366,6 +10565,100 @@ llvm::LoadInst* JITCompiler::loadMemberValue(
 	return pTypeVal;	
 }
 
+/***************************************************************
+* Function: JITCompiler::storeMemberValue()
+* Purpose : Store a member value to memory
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::StoreInst* JITCompiler::storeMemberValue(
+	llvm::IRBuilder<>& irBuilder,
+	llvm::Value* pObjPointer,
+	size_t valOffset,
+	llvm::Value* pValue
+)
+{	
+	// Add the offset to the object base pointer
+	llvm::Value* pMemberAddr = irBuilder.CreateGEP(
+		pObjPointer, 
+		llvm::ConstantInt::get(
+			getIntType(PLATFORM_POINTER_SIZE),
+			valOffset
+		)
+	);
+	
+	// Cast the member address to a pointer of the value's type
+	llvm::Value* pMemberPtr = irBuilder.CreateCast(
+		llvm::Instruction::BitCast,
+		pMemberAddr,
+		llvm::PointerType::getUnqual(pValue->getType())
+	);
+	
+	// Write the value to memory
+	return irBuilder.CreateStore(pValue, pMemberPtr);
+}
+
+/***************************************************************
+* Function: JITCompiler::loadSizeArray()
+* Purpose : Load the size array pointer of a matrix object
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::LoadInst* JITCompiler::loadSizeArray(
+	llvm::IRBuilder<>& irBuilder,
+	llvm::Value* pMatrixObj
+)
+{
+	// Load the data pointer of the matrix size vector directly, the
+	// pointer must be reloaded after any call that may resize the matrix
+	return loadMemberValue(
+		irBuilder,
+		pMatrixObj,
+		MEMBER_OFFSET(BaseMatrixObj, m_size) + MEMBER_OFFSET(DimVector, m_ptr),
+		llvm::PointerType::getUnqual(getIntType(sizeof(size_t)))
+	);
+}
+
+/***************************************************************
+* Function: JITCompiler::loadDimCount()
+* Purpose : Load the dimension count of a matrix object
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::loadDimCount(
+	llvm::IRBuilder<>& irBuilder,
+	llvm::Value* pMatrixObj
+)
+{
+	// Load the element count of the matrix size vector
+	llvm::Value* pDimCount = loadMemberValue(
+		irBuilder,
+		pMatrixObj,
+		MEMBER_OFFSET(BaseMatrixObj, m_size) + MEMBER_OFFSET(DimVector, m_n),
+		getIntType(sizeof(unsigned int))
+	);
+
+	// Widen the count to the size type used for index computations
+	return irBuilder.CreateIntCast(pDimCount, getIntType(sizeof(size_t)), false);
+}
+
+/***************************************************************
+* Function: JITCompiler::getColdBranchWeights()
+* Purpose : Get branch weights marking a true branch cold
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::MDNode* JITCompiler::getColdBranchWeights()
+{
+	// Weight the false branch heavily so error and resize paths are
+	// laid out away from the hot array access code
+	return llvm::MDBuilder(*s_Context).createBranchWeights(1, 2000);
+}
+
 /***************************************************************
 * Function: JITCompiler::createNativeCall()
 * Purpose : Create a native function call
@@ -8415,6 +10708,10 @@ Revisions and bug fixes:
 */
 llvm::Constant* JITCompiler::createPtrConst(const void* pPointer, llvm::Type* valType)
 {
+	// Code embedding the address of an object cannot be cached
+	if (pPointer != NULL && s_pCacheBuild != NULL)
+		s_pCacheBuild->cacheable = false;
+	
 	// Get the integer type matching the size of pointers on this platform
 	llvm::Type* intType = getIntType(PLATFORM_POINTER_SIZE);
 		
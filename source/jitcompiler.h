@@ -25,6 +25,10 @@
 #include <ext/hash_map>
 #include <vector>
 #include <map>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <llvm/LLVMContext.h>
 #include <llvm/Function.h>
 #include <llvm/PassManager.h>
@@ -49,6 +53,7 @@
 #include "analysis_metrics.h"
 #include "analysis_boundscheck.h"
 #include "analysis_copyplacement.h"
+#include "arrayfusion.h"
 
 /***************************************************************
 * Class   : CompError
@@ -138,10 +143,19 @@ public:
 	);
 	
 	// Method to compile a program function given argument types
-	static void compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr);
+	static void compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr, bool deferCodeGen = false);
+	
+	// Method to precompile a function into the code cache
+	static void compileAheadOfTime(const std::string& funcName, const std::string& argTypesText);
 	
 	// Method to call a JIT-compiled version of a function
-	static ArrayObj* callFunction(ProgFunction* pFunction, ArrayObj* pArguments, size_t outArgCount);
+	static ArrayObj* callFunction(ProgFunction* pFunction, ArrayObj* pArguments, size_t outArgCount, const ParamExpr* pCallSite = NULL, bool tiered = false);
+	
+	// Method to get the iteration count at which a loop should be replaced
+	static size_t getOsrThreshold(const LoopStmt* pLoopStmt);
+	
+	// Method to finish the execution of an interpreted loop in compiled code
+	static bool osrEnterLoop(const LoopStmt* pLoopStmt, Environment* pEnv);
 	
 	// Config variable to enable/disable the JIT compiler
 	static ConfigVar s_jitEnableVar;
@@ -151,6 +165,7 @@ public:
 	static ConfigVar s_jitUseBinOpOpts;
 	static ConfigVar s_jitUseLibOpts;
 	static ConfigVar s_jitUseDirectCalls;
+	static ConfigVar s_jitUseCallCaches;
 	
 	// Config variables to disable matrix read/write bounds checking
 	static ConfigVar s_jitNoReadBoundChecks;
@@ -162,6 +177,20 @@ public:
     // Config variables to enable/disable on-stack replacement
     static ConfigVar s_jitOsrEnableVar;
     static ConfigVar s_jitOsrStrategyVar;
+    static ConfigVar s_jitOsrThresholdVar;
+
+	// Config variable for the number of interpreted calls before compiling a function
+	static ConfigVar s_jitHotThresholdVar;
+	
+	// Config variable to enable/disable code generation in a background thread
+	static ConfigVar s_jitBackgroundVar;
+	
+	// Config variable for the optimization level of the generated code
+	static ConfigVar s_jitOptLevelVar;
+	
+	// Config variables for ahead-of-time compilation into the code cache
+	static ConfigVar s_aotCompileVar;
+	static ConfigVar s_aotArgTypesVar;
 
 private:
 	
@@ -325,6 +354,15 @@ private:
 		
 		// Pointer to the compiled wrapper function code
 		WRAPPER_FUNC_PTR pWrapperPtr;
+		
+		// Code cache key (empty if the version is not in the code cache)
+		std::string cacheKey;
+		
+		// Code cache reference table for the embedded objects
+		std::string cacheRefs;
+		
+		// Code cache list of the program functions the version depends on
+		std::string cacheDeps;
 	};
 	
 	// Compiled version map type definition
@@ -349,6 +387,170 @@ private:
 	// Function map type definition
 	typedef std::map<ProgFunction*, CompFunction, std::less<ProgFunction*>, gc_allocator<std::pair<ProgFunction*, CompFunction> > > FunctionMap;
 	
+	// Maximum number of versions cached per call site
+	static const size_t CALL_CACHE_ENTRIES = 4;
+	
+	// Maximum number of arguments handled by call site caches
+	static const size_t CALL_CACHE_MAX_ARGS = 8;
+	
+	// Call site cache entry structure
+	struct CallCacheEntry
+	{
+		// Function called
+		ProgFunction* pFunction;
+		
+		// Number of arguments
+		size_t numArgs;
+		
+		// Type tags of the arguments
+		uint32 argTags[CALL_CACHE_MAX_ARGS];
+		
+		// Wrapper of the compiled version for these arguments
+		WRAPPER_FUNC_PTR pWrapperPtr;
+	};
+	
+	// Call site cache structure
+	struct CallSiteCache : public gc
+	{
+		CallSiteCache(): numEntries(0), nextEntry(0) {}
+		
+		// Cached function versions
+		CallCacheEntry entries[CALL_CACHE_ENTRIES];
+		
+		// Number of valid entries
+		size_t numEntries;
+		
+		// Index of the next entry to replace
+		size_t nextEntry;
+	};
+	
+	// Hot function version key type definition
+	typedef std::pair<ProgFunction*, TypeSetString> HotCountKey;
+	
+	// Interpreted call count map type definition
+	typedef std::map<HotCountKey, size_t, std::less<HotCountKey>, gc_allocator<std::pair<HotCountKey, size_t> > > HotCountMap;
+	
+	// Pending code generation queue type definition
+	typedef std::deque<CompVersion*> CompQueue;
+	
+	// Set of function versions being loaded type definition
+	typedef std::set<HotCountKey, std::less<HotCountKey>, gc_allocator<HotCountKey> > LoadingSet;
+	
+	// IIR node vector type definition
+	typedef std::vector<const IIRNode*> NodeVector;
+	
+	// IIR node index map type definition
+	typedef std::map<const IIRNode*, size_t> NodeIndexMap;
+	
+	// Code cache record of the version being compiled
+	struct CacheBuild
+	{
+		// Constructor, makes this record the active one
+		CacheBuild(ProgFunction* pFunc, const StmtSequence* pFuncBody, bool enabled);
+		
+		// Destructor, restores the previously active record
+		~CacheBuild();
+		
+		// Program function being compiled
+		ProgFunction* pFunction;
+		
+		// Indices of the function body nodes
+		NodeIndexMap nodeIndices;
+		
+		// Reference globals created for embedded objects
+		std::map<const void*, llvm::Constant*> refGlobals;
+		
+		// Reference table text
+		std::string refTable;
+		
+		// Indicates if the generated code can be cached
+		bool cacheable;
+		
+		// Previously active record
+		CacheBuild* pPrevBuild;
+	};
+	
+	// Maximum number of loop functions per interpreted loop
+	static const size_t OSR_MAX_LOOP_FUNCS = 4;
+	
+	// OSR loop structure
+	struct OsrLoop
+	{
+		OsrLoop(): replaceable(true) {}
+		
+		// Flag indicating the loop may be replaced
+		bool replaceable;
+		
+		// Loop functions, one per environment enclosing the loop's frame
+		ProgFunction::FuncVector loopFuncs;
+	};
+	
+	// OSR loop map type definition
+	typedef __gnu_cxx::hash_map<const LoopStmt*, OsrLoop, IntHashFunc<const LoopStmt*>, __gnu_cxx::equal_to<const LoopStmt*>, gc_allocator<OsrLoop> > OsrLoopMap;
+	
+	// Method to optimize and generate machine code for a function version
+	static void genMachineCode(CompVersion& version);
+	
+	// Method to generate the code of a pending function version immediately
+	static void finishPendingVersion(CompVersion& version);
+	
+	// Entry point of the background compilation thread
+	static void compThreadMain();
+	
+	// Method to get the code cache key of a function version
+	static std::string getCacheKey(const CompFunction& function, const TypeSetString& argTypeStr);
+	
+	// Method to get the source hash of a program function
+	static uint64 getSourceHash(const ProgFunction* pFunction);
+	
+	// Method to list the program functions a function may depend on
+	static std::string getCacheDeps(ProgFunction* pFunction);
+	
+	// Method to list the nodes of a function body in a fixed order
+	static void listIIRNodes(const IIRNode* pNode, NodeVector& nodes);
+	
+	// Method to load a function version from the code cache
+	static bool loadCachedVersion(CompFunction& function, const TypeSetString& argTypeStr, const std::string& keyText);
+	
+	// Method to link a cached function version into the module
+	static bool linkCachedVersion(CompFunction& function, const TypeSetString& argTypeStr, const std::string& keyText);
+	
+	// Method to store a function version in the code cache
+	static bool storeCachedVersion(const CompVersion& version);
+	
+	// Method to create a reference to an IIR node or function object
+	static llvm::Constant* createObjRef(const IIRNode* pNode);
+	
+	// Method to run the optimization passes on a function
+	static void runOptPasses(llvm::Function* pFuncObj);
+	
+	// Method to create the optimization passes for the current level
+	static void createOptPasses();
+	
+	// Method to inline the small compiled functions called directly
+	static size_t inlineDirectCalls(llvm::Function* pFuncObj);
+	
+	// Maximum number of instructions of an inlined function
+	static const size_t INLINE_MAX_INSTRS = 200;
+	
+	// Method to parse a list of argument type names
+	static TypeSetString parseArgTypes(const std::string& argTypesText);
+	
+	// Method to record a direct call to another function version
+	static void recordVersionRef(ProgFunction* pCallee, const CompVersion& calleeVersion, const CompVersion& callerVersion);
+	
+	// Methods to write and read type information as text
+	static bool writeTypeSetStr(const TypeSetString& typeSetStr, Environment* pEnv, std::string& text);
+	static bool writeTypeInfo(const TypeInfo& type, Environment* pEnv, std::string& text);
+	static bool readTypeSetStr(std::istream& stream, Environment* pEnv, TypeSetString& typeSetStr);
+	static bool readTypeInfo(std::istream& stream, Environment* pEnv, TypeInfo& type);
+	
+	// Maximum number of matrix dimensions read from the code cache
+	static const size_t MAX_CACHED_DIMS = 64;
+	
+	// Method to test if a statement sequence contains a return statement
+	static bool containsReturn(const StmtSequence* pSeqStmt);
+	
 	// Binary operator factory function type definition
 	typedef llvm::Value* (*BINOP_FACTORY_FUNC)(llvm::IRBuilder<>& builder, llvm::Value* pLVal, llvm::Value* pRVal);
 	
@@ -579,6 +781,25 @@ private:
 		llvm::BasicBlock* pExitBlock
 	);
 	
+	// Method to get the fused operation to use for an expression, if any
+	static FusedArrayOp* getFusedArrayOp(
+		const Expression* pExpr,
+		CompVersion& version
+	);
+	
+	// Method to compile a fused element-wise expression tree
+	static Value compFusedArrayOp(
+		FusedArrayOp* pFusedOp,
+		CompFunction& function,
+		CompVersion& version,
+		const Expression::SymbolSet& liveVars,
+		const VarDefMap& reachDefs,
+		const VarTypeMap& varTypes,
+		VariableMap& varMap,
+		llvm::BasicBlock* pEntryBlock,
+		llvm::BasicBlock* pExitBlock
+	);
+	
 	// Method to generate code for binary operations
 	static Value compBinaryOp(
 		Expression* pLeftExpr,
@@ -780,6 +1001,29 @@ private:
 		llvm::Type* valType
 	);
 	
+	// Method to store a member value to memory
+	static llvm::StoreInst* storeMemberValue(
+		llvm::IRBuilder<>& irBuilder,
+		llvm::Value* pObjPointer,
+		size_t valOffset,
+		llvm::Value* pValue
+	);
+
+	// Method to load the size array pointer of a matrix object
+	static llvm::LoadInst* loadSizeArray(
+		llvm::IRBuilder<>& irBuilder,
+		llvm::Value* pMatrixObj
+	);
+
+	// Method to load the dimension count of a matrix object
+	static llvm::Value* loadDimCount(
+		llvm::IRBuilder<>& irBuilder,
+		llvm::Value* pMatrixObj
+	);
+
+	// Method to get the branch weights marking a true branch cold
+	static llvm::MDNode* getColdBranchWeights();
+
 	// Method to create a native function call
 	static llvm::CallInst* createNativeCall(
 		llvm::IRBuilder<>& irBuilder,
@@ -859,6 +1103,36 @@ private:
 	
 	// Map of program functions to function objects
 	static FunctionMap s_functionMap;
+	
+	// Map of interpreted loops to their OSR loop functions
+	static OsrLoopMap s_osrLoopMap;
+	
+	// Map of function versions to their interpreted call counts
+	static HotCountMap s_hotCountMap;
+	
+	// Mutex protecting the LLVM state and the code generation queue
+	static std::recursive_mutex s_compMutex;
+	
+	// Condition signaled when code generation is queued
+	static std::condition_variable_any s_compCond;
+	
+	// Function versions waiting for code generation
+	static CompQueue s_compQueue;
+	
+	// Background compilation thread (NULL if not started)
+	static std::thread* s_pCompThread;
+	
+	// Flag requesting the background compilation thread to exit
+	static bool s_stopCompThread;
+	
+	// Code cache record of the version being compiled (NULL if none)
+	static CacheBuild* s_pCacheBuild;
+	
+	// Counter used to give code cache globals unique names
+	static size_t s_cacheNameCount;
+	
+	// Function versions being loaded from the code cache
+	static LoadingSet s_loadingVersions;
 
         static llvm::DataLayout* s_data_layout ;
 
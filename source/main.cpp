@@ -25,8 +25,14 @@
 #include "interpreter.h"
 #include "jitcompiler.h"
 #include "profiling.h"
+#include "gcmanager.h"
 #include "filesystem.h"
 #include "parser.h"
+#include "parsecache.h"
+#include "codecache.h"
+#include "arrayfusion.h"
+#include "simdkernels.h"
+#include "workerpool.h"
 #include "utility.h"
 #include "client.h"
 
@@ -64,16 +70,34 @@ int main(int argc, char** argv)
 	// Initialize the profiler
 	Profiler::initialize();
 
+	// Initialize the garbage collector settings
+	GCManager::initialize();
+
+	// Initialize the parse cache
+	ParseCache::initialize();
+
+	// Initialize the compiled code cache
+	CodeCache::initialize();
+
+	// Initialize the expression fusion stage
+	FusedArrayOp::initialize();
+
+	// Initialize the vectorized array kernels
+	SimdKernels::initialize();
+	WorkerPool::initialize();
+
 	// Parse the command-line arguments
 	ConfigManager::parseCmdArgs(argc, argv);
 
+	// Apply the garbage collector settings
+	GCManager::configure();
+
     // OSR depends on the osr-flag being enabled, try it 
     // after parsing the command line arguments
     JITCompiler::initializeOSR();
 
-	// TODO NAL: get host name and port from Config ...
-	// create and connect to natlab (server mode)
-	Client::openSocketStream(Client::FRONTEND_DEFAULT_HOST, Client::FRONTEND_DEFAULT_PORT);
+	// Note: the natlab frontend (server mode) is started lazily by the
+	// client, on the first parse request that misses the parse cache
 			
 	// Load the standard library
         mcvm::stdlib::loadLibrary();
@@ -88,8 +112,26 @@ int main(int argc, char** argv)
 		std::cout << "WARNING: could not change to specified starting directory" << std::endl;
 	}
 
+	// If ahead-of-time compilation was requested for the target file
+	if (ConfigManager::getFileName() != "" && JITCompiler::s_aotCompileVar.getBoolValue() == true)
+	{
+		// Setup a try block to catch errors
+		try
+		{
+			// Precompile the target file into the code cache, without running it
+			JITCompiler::compileAheadOfTime(ConfigManager::getFileName(), JITCompiler::s_aotArgTypesVar.getStringValue());
+		}
+
+		// If any error occurs
+		catch (RunError error)
+		{
+			// Print the run-time error
+			std::cout << std::endl << "Run-time error: " << std::endl << error.toString() << std::endl;
+		}
+	}
+
 	// If the target file name was set
-	if (ConfigManager::getFileName() != "")
+	else if (ConfigManager::getFileName() != "")
 	{
 		// Setup a try block to catch errors
 		try
@@ -67,7 +67,7 @@ bool BaseMatrixObj::validIndices(const ArrayObj* pSlice) const
 		if (pObj->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the matrix object
-			MatrixF64Obj* pMatrix = (MatrixF64Obj*)pObj;
+			const MatrixF64Obj* pMatrix = (const MatrixF64Obj*)pObj;
 			
 			// Get pointers to the start and end values
 			const float64* pStartVal = pMatrix->getElements();
@@ -145,7 +145,7 @@ DimVector BaseMatrixObj::getMaxIndices(const ArrayObj* pSlice, const BaseMatrixO
 		if (pObj->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the matrix object
-			MatrixF64Obj* pMatrix = (MatrixF64Obj*)pObj;
+			const MatrixF64Obj* pMatrix = (const MatrixF64Obj*)pObj;
 			
 			// Get pointers to the start and end values
 			const float64* pStartVal = pMatrix->getElements();
@@ -163,7 +163,7 @@ DimVector BaseMatrixObj::getMaxIndices(const ArrayObj* pSlice, const BaseMatrixO
 		else if (pObj->getType() == DataObject::LOGICALARRAY)
 		{
 			// Get a typed pointer to the matrix object
-			LogicalArrayObj* pMatrix = (LogicalArrayObj*)pObj;
+			const LogicalArrayObj* pMatrix = (const LogicalArrayObj*)pObj;
 				
 			// Get pointers to the start and end values
 			const bool* pStartVal = pMatrix->getElements();
@@ -466,6 +466,40 @@ template <> DataObject* MatrixObj<DataObject*>::convert(DataObject::Type outType
 	return DataObject::convert(outType);
 }
 
+/***************************************************************
+* Function: MatrixObj<float64>::isAllInteger()
+* Purpose : Test if all the elements of a 64-bit float matrix
+*           are integer, caching the result
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> bool MatrixObj<float64>::isAllInteger() const
+{
+	// If the integer flag is not yet known
+	if (m_intFlag == INT_UNKNOWN)
+	{
+		// Initially, assume all the values are integer
+		m_intFlag = INT_ALL;
+		
+		// For each value in the matrix
+		const float64* pLastElem = m_pElements + m_numElements;
+		for (const float64* pValue = m_pElements; pValue < pLastElem; ++pValue)
+		{
+			// If this value is not integer
+			if (::isInteger(*pValue) == false)
+			{
+				// Clear the flag and stop the scan
+				m_intFlag = INT_NOT_ALL;
+				break;
+			}
+		}
+	}
+	
+	// Return the cached result
+	return m_intFlag == INT_ALL;
+}
+
 /***************************************************************
 * Function: static MatrixObj<float64>::matrixMult()
 * Purpose : Matrix multiplication of 64-bit float matrices
@@ -660,10 +694,15 @@ template <> MatrixObj<float64>* MatrixObj<float64>::matrixLeftDiv(const MatrixOb
 		
 		// Make a copy of B to store the output
 		MatrixF64Obj* pOutMatrix = pMatrixB->copy();
+		pOutMatrix->unshare();
+
+		// Make a private copy of A, which is overwritten by its LU factors
+		MatrixF64Obj* pLUMatrix = pMatrixA->copy();
+		pLUMatrix->unshare();
 #ifdef MCVM_USE_CLAPACK	
 		integer n 		= pMatrixA->m_size[0];		// N - number of rows/cols of A
 		integer nrhs 	= pMatrixB->m_size[1];		// number of cols of B	
-		doublereal* a	= pMatrixA->m_pElements;	// Matrix A
+		doublereal* a	= pLUMatrix->m_pElements;	// Matrix A
 		integer lda		= pMatrixA->m_size[0];		// Stride of A
 		integer* ipiv	= new integer[n];			// (output) pivot indices
 		doublereal* b	= pOutMatrix->m_pElements;	// Matrix B
@@ -689,10 +728,10 @@ template <> MatrixObj<float64>* MatrixObj<float64>::matrixLeftDiv(const MatrixOb
 		int *ipiv = new int[n];
 		int info;
 #ifdef MCVM_USE_ACML
-		dgesv(pMatrixA->m_size[0],pMatrixB->m_size[1],pMatrixA->m_pElements,pMatrixA->m_size[0],ipiv,pOutMatrix->m_pElements,pMatrixB->m_size[0],&info);
+		dgesv(pMatrixA->m_size[0],pMatrixB->m_size[1],pLUMatrix->m_pElements,pMatrixA->m_size[0],ipiv,pOutMatrix->m_pElements,pMatrixB->m_size[0],&info);
 #endif
 #ifdef MCVM_USE_LAPACKE
-		info = LAPACKE_dgesv(LAPACK_COL_MAJOR, pMatrixA->m_size[0],pMatrixB->m_size[1],pMatrixA->m_pElements,pMatrixA->m_size[0],ipiv,pOutMatrix->m_pElements,pMatrixB->m_size[0]);
+		info = LAPACKE_dgesv(LAPACK_COL_MAJOR, pMatrixA->m_size[0],pMatrixB->m_size[1],pLUMatrix->m_pElements,pMatrixA->m_size[0],ipiv,pOutMatrix->m_pElements,pMatrixB->m_size[0]);
 #endif
 		delete[] ipiv;
 #endif
@@ -731,6 +770,7 @@ template <> MatrixObj<float64>* MatrixObj<float64>::matrixLeftDiv(const MatrixOb
 		integer n = pMatrixA->m_size[1];    //columns of the matrix A
 		integer k = m>n?n:m;
 		MatrixObj *pMatrixQR = pMatrixA->copy();
+		pMatrixQR->unshare();
 		doublereal *a = pMatrixQR->m_pElements; // the elements of matrix A
 		integer lda = pMatrixA->m_size[0];  // lda/Stride/leading dimension of A	
 		integer *jpvt = new integer[n];     // the permutation matrix, input is 0, meaning all columns can freely by pivoted ('free columns')
@@ -774,6 +814,7 @@ template <> MatrixObj<float64>* MatrixObj<float64>::matrixLeftDiv(const MatrixOb
 		int n = pMatrixA->m_size[1];    //columns of the matrix A
 		int k = m>n?n:m;
 		MatrixObj *pMatrixQR = pMatrixA->copy();
+		pMatrixQR->unshare();
 		double *a = pMatrixQR->m_pElements; // the elements of matrix A
 		int lda = pMatrixA->m_size[0];  // lda/Stride/leading dimension of A	
 		int *jpvt = new int[n];     // the permutation matrix, input is 0, meaning all columns can freely by pivoted ('free columns')
@@ -791,6 +832,7 @@ template <> MatrixObj<float64>* MatrixObj<float64>::matrixLeftDiv(const MatrixOb
 		
 		//****compute QB = (Q'*B) via dormqr
 		MatrixObj *pMatrixQB = pMatrixB->copy(); //need a place to store qb, and input of B
+		pMatrixQB->unshare();
 #ifdef MCVM_USE_CLAPACK
 		char side  = 'L';
 		char trans = 'T';
@@ -986,10 +1028,15 @@ template <> MatrixObj<Complex128>* MatrixObj<Complex128>::matrixLeftDiv(const Ma
 #ifdef MCVM_USE_CLAPACK
 		// Make a copy of B to store the output
 		MatrixC128Obj* pOutMatrix = pMatrixB->copy();
+		pOutMatrix->unshare();
+
+		// Make a private copy of A, which is overwritten by its LU factors
+		MatrixC128Obj* pLUMatrix = pMatrixA->copy();
+		pLUMatrix->unshare();
 		
 		integer n 			= pMatrixA->m_size[0];						// N - number of rows/cols of A
 		integer nrhs 		= pMatrixB->m_size[1];						// number of cols of B	
-		doublecomplex* a	= (doublecomplex*)pMatrixA->m_pElements;	// Matrix A
+		doublecomplex* a	= (doublecomplex*)pLUMatrix->m_pElements;	// Matrix A
 		integer lda			= pMatrixA->m_size[0];						// Stride of A
 		integer* ipiv		= new integer[n];							// (output) pivot indices
 		doublecomplex* b	= (doublecomplex*)pOutMatrix->m_pElements;	// Matrix B
@@ -1012,6 +1059,11 @@ template <> MatrixObj<Complex128>* MatrixObj<Complex128>::matrixLeftDiv(const Ma
 		delete [] ipiv;
 #else
 		MatrixC128Obj* pOutMatrix = pMatrixB->copy();
+		pOutMatrix->unshare();
+
+		// Make a private copy of A, which is overwritten by its LU factors
+		MatrixC128Obj* pLUMatrix = pMatrixA->copy();
+		pLUMatrix->unshare();
 		
 		int n 			= pMatrixA->m_size[0];						// N - number of rows/cols of A
 		int nrhs 		= pMatrixB->m_size[1];						// number of cols of B	
@@ -1020,7 +1072,7 @@ template <> MatrixObj<Complex128>* MatrixObj<Complex128>::matrixLeftDiv(const Ma
 		int ldb			= pMatrixB->m_size[0];						// Stride of B
 		int info;													// (output) convergence info
 #ifdef MCVM_USE_ACML	
-		doublecomplex* a	= (doublecomplex*)pMatrixA->m_pElements;	// Matrix A
+		doublecomplex* a	= (doublecomplex*)pLUMatrix->m_pElements;	// Matrix A
 		doublecomplex* b	= (doublecomplex*)pOutMatrix->m_pElements;	// Matrix B
 		zgesv_(
 			&n,
@@ -1034,7 +1086,7 @@ template <> MatrixObj<Complex128>* MatrixObj<Complex128>::matrixLeftDiv(const Ma
 		);
 #endif
 #ifdef MCVM_USE_LAPACKE
-		lapack_complex_double *a = (lapack_complex_double*)pMatrixA->m_pElements;
+		lapack_complex_double *a = (lapack_complex_double*)pLUMatrix->m_pElements;
 		lapack_complex_double *b = (lapack_complex_double*)pOutMatrix->m_pElements;
 		info = LAPACKE_zgesv(LAPACK_COL_MAJOR,n,nrhs,a,lda,ipiv,b,ldb);
 #endif
@@ -34,6 +34,9 @@
 #include "utility.h"
 #include "profiling.h"
 #include "dimvector.h"
+#include "simdkernels.h"
+#include "workerpool.h"
+#include "slaballoc.h"
 // Dimension vector type definition
 //typedef std::vector<size_t, gc_allocator<size_t> > DimVector;
 
@@ -80,6 +83,9 @@ public:
 	// Method to concatenate this matrix with another matrix
 	virtual BaseMatrixObj* concat(const BaseMatrixObj* pOther, size_t catDim) const = 0;
 	
+	// Method to free the elements of a dead matrix, leaving it empty
+	virtual bool releaseElements() = 0;
+	
 	// Static method to test if matrices are compatible for multiplication
 	static bool multCompatible(const BaseMatrixObj* pMatrixA, const BaseMatrixObj* pMatrixB);
 	
@@ -144,12 +150,24 @@ template <class ScalarType> class MatrixObj : public BaseMatrixObj
 	
 public:
 	
+	// Enumerate the states of the cached all-integer flag
+	enum IntFlag
+	{
+		INT_UNKNOWN,
+		INT_ALL,
+		INT_NOT_ALL
+	};
+	
 	// Method to get the object type associated with this class
 	inline DataObject::Type getClassType();
 	
+	// Matrix objects are carved out of size-class slabs of collectable memory
+	static void* operator new(size_t size) { return SlabAlloc::allocate(size); }
+	static void operator delete(void* pObject, size_t size) { SlabAlloc::deallocate(pObject, size); }
+	
 	// Default constructor (empty matrix)
 	MatrixObj()
-	: m_pElements(NULL)
+	: m_pElements(NULL), m_shared(false), m_intFlag(INT_UNKNOWN)
 	{
 		// Initialize the matrix size
 		m_size.resize(2, 0);
@@ -166,6 +184,7 @@ public:
 
 	// Scalar constructor (1x1 matrix)
 	MatrixObj(ScalarType elemValue)
+	: m_shared(false), m_intFlag(INT_UNKNOWN)
 	{
 		// Initialize the matrix size
 		m_size.resize(2, 1);		
@@ -185,6 +204,7 @@ public:
 	
 	// 2D matrix constructor (m x n matrix)
 	MatrixObj(size_t numRows, size_t numCols, ScalarType elemValue = 0)
+	: m_shared(false), m_intFlag(INT_UNKNOWN)
 	{
 		// Set the object type
 		m_type = getClassType();
@@ -208,6 +228,7 @@ public:
 	
 	// N-dimensional matrix constructor (m x n x p x ... matrix)
 	MatrixObj(const DimVector& newSize, ScalarType elemValue = 0)
+	: m_shared(false), m_intFlag(INT_UNKNOWN)
 	{
 		// Set the object type
 		m_type = getClassType();
@@ -261,17 +282,89 @@ public:
 		
 		// Copy the matrix dimensions
 		pNewMatrix->m_size = m_size;
+		pNewMatrix->m_numElements = m_numElements;
 		
-		// Allocate memory for the new matrix
-		pNewMatrix->allocMatrix();
+		// If the element is stored inline, copy it into the new matrix
+		if (m_pElements == &m_scalarElem)
+		{
+			pNewMatrix->m_scalarElem = m_scalarElem;
+			pNewMatrix->m_pElements = &pNewMatrix->m_scalarElem;
+		}
+		else
+		{
+			// Share the matrix elements with the new matrix, the elements
+			// will only be copied when one of the matrices is written to
+			pNewMatrix->m_pElements = m_pElements;
+			pNewMatrix->m_shared = true;
+			m_shared = true;
+		}
 		
-		// Copy all the matrix elements into the new matrix
-		memcpy(pNewMatrix->m_pElements, m_pElements, sizeof(ScalarType) * m_numElements);
+		// The copy has the same elements, keep the integer flag
+		pNewMatrix->m_intFlag = m_intFlag;
 		
 		// Return the new matrix object
 		return pNewMatrix;
 	}
 	
+	// Method to give this matrix its own copy of shared elements
+	void unshare()
+	{
+		// The elements are about to be written, forget the integer flag
+		m_intFlag = INT_UNKNOWN;
+		
+		// If the elements are not shared, do nothing
+		if (!m_shared)
+			return;
+		
+		// Store a pointer to the shared elements
+		ScalarType* pOldElements = m_pElements;
+		
+		// Allocate memory for the private copy
+		allocMatrix();
+		
+		// Copy all the matrix elements into the private copy
+		memcpy(m_pElements, pOldElements, sizeof(ScalarType) * m_numElements);
+		
+		// The elements are no longer shared
+		m_shared = false;
+		
+		// Increment the array copy count
+		PROF_INCR_COUNTER(Profiler::ARRAY_COPY_COUNT);
+	}
+	
+	// Static method to unshare the elements of a matrix
+	static void unshareMatrix(MatrixObj* pMatrix) { pMatrix->unshare(); }
+	
+	// Accessor to tell if the matrix elements are shared
+	bool isShared() const { return m_shared; }
+	
+	// Method to free the elements of a dead matrix, leaving it empty
+	// Note: the caller must know that no other reference to this matrix
+	//       is still in use, otherwise the collector would do this
+	virtual bool releaseElements()
+	{
+		// Shared and inline elements cannot be freed
+		if (m_shared || m_pElements == NULL || m_pElements == &m_scalarElem)
+			return false;
+		
+		// Give the elements back to the collector right away
+		GC_FREE(m_pElements);
+		
+		// Make this matrix an empty matrix
+		m_pElements = NULL;
+		m_size.resize(2);
+		m_size[0] = 0;
+		m_size[1] = 0;
+		m_numElements = 0;
+		m_intFlag = INT_UNKNOWN;
+		
+		// The elements were freed
+		return true;
+	}
+	
+	// Method to test if all the matrix elements are integer
+	bool isAllInteger() const;
+	
 	// Method to obtain a string representation of this object
 	virtual std::string toString() const
 	{
@@ -528,8 +621,13 @@ public:
 		// Recursively perform the matrix expansion
 		expand(oldSize, newSize, srcStride, dstStride, pOldElements, m_pElements, newSize.size() - 1);
 		
-		// Delete the old matrix elements
-		delete [] pOldElements;
+		// Delete the old matrix elements, unless another matrix still uses
+		// them or they were stored inline
+		if (!m_shared && pOldElements != &m_scalarElem)
+			delete [] pOldElements;
+		
+		// The new elements belong to this matrix only
+		m_shared = false;
 	}
 
 	// Method to recursively expand this matrix
@@ -609,7 +707,7 @@ public:
 				if (pCurSlice->getType() == DataObject::LOGICALARRAY)
 				{
 					// Get a typed pointer to the matrix object
-					MatrixObj<bool>* pMatrix = (MatrixObj<bool>*)pCurSlice;
+					const MatrixObj<bool>* pMatrix = (const MatrixObj<bool>*)pCurSlice;
 						
 					// Get pointers to the start and end values
 					const bool* pStartVal = pMatrix->getElements();
@@ -727,7 +825,7 @@ public:
 			if (pCurSlice->getType() == DataObject::MATRIX_F64)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<float64>* pMatrix = (MatrixObj<float64>*)pCurSlice;
+				const MatrixObj<float64>* pMatrix = (const MatrixObj<float64>*)pCurSlice;
 				
 				// Get pointers to the start and end values
 				const float64* pStartVal = pMatrix->getElements();
@@ -748,7 +846,7 @@ public:
 			else if (pCurSlice->getType() == DataObject::LOGICALARRAY)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<bool>* pMatrix = (MatrixObj<bool>*)pCurSlice;
+				const MatrixObj<bool>* pMatrix = (const MatrixObj<bool>*)pCurSlice;
 					
 				// Get pointers to the start and end values
 				const bool* pStartVal = pMatrix->getElements();
@@ -859,7 +957,7 @@ public:
 			if (pCurSlice->getType() == DataObject::MATRIX_F64)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<float64>* pMatrix = (MatrixObj<float64>*)pCurSlice;
+				const MatrixObj<float64>* pMatrix = (const MatrixObj<float64>*)pCurSlice;
 
 				// Get pointers to the start and end values
 				const float64* pStartVal = pMatrix->getElements();
@@ -886,7 +984,7 @@ public:
 			else if (pCurSlice->getType() == DataObject::LOGICALARRAY)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<bool>* pMatrix = (MatrixObj<bool>*)pCurSlice;
+				const MatrixObj<bool>* pMatrix = (const MatrixObj<bool>*)pCurSlice;
 					
 				// Get pointers to the start and end values
 				const bool* pStartVal = pMatrix->getElements();
@@ -992,6 +1090,9 @@ public:
 	{
 		// Ensure that the slice has at most as many dimensions as this matrix
 		assert (pSlice->getSize() <= m_size.size());
+		
+		// Copy the elements if they are shared
+		unshare();
 	
 		// Declare a pointer for the source matrix
 		MatrixObj* pSrcMatrix;
@@ -1115,7 +1216,7 @@ public:
 			if (pCurSlice->getType() == DataObject::MATRIX_F64)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<float64>* pMatrix = (MatrixObj<float64>*)pCurSlice;
+				const MatrixObj<float64>* pMatrix = (const MatrixObj<float64>*)pCurSlice;
 				
 				// Get pointers to the start and end values
 				const float64* pStartVal = pMatrix->getElements();
@@ -1216,7 +1317,7 @@ public:
 			if (pCurSlice->getType() == DataObject::MATRIX_F64)
 			{
 				// Get a typed pointer to the matrix object
-				MatrixObj<float64>* pMatrix = (MatrixObj<float64>*)pCurSlice;
+				const MatrixObj<float64>* pMatrix = (const MatrixObj<float64>*)pCurSlice;
 
 				// Get pointers to the start and end values
 				const float64* pStartVal = pMatrix->getElements();
@@ -1365,6 +1466,9 @@ public:
 		// Ensure that the index is valid
 		assert (index < m_numElements);
 
+		// Copy the elements if they are shared
+		unshare();
+
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1405,6 +1509,9 @@ public:
 		// Ensure the index is valid
 		assert (index < m_numElements);
 		
+		// Copy the elements if they are shared
+		unshare();
+		
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1452,6 +1559,9 @@ public:
 		// Ensure that the global index is valid
 		assert (index < m_numElements);
 		
+		// Copy the elements if they are shared
+		unshare();
+		
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1609,23 +1719,117 @@ public:
 		assert (false);
 	}	
 	
+	// Task data for an array (per-element) operation on a range of elements
+	template <class InScalarType, class OutType> struct ElemOpTask
+	{
+		// Input element arrays
+		const ScalarType* pInA;
+		const ScalarType* pInB;
+		
+		// Scalar operand and its conversion to the element type
+		InScalarType scalar;
+		ScalarType scalarVal;
+		
+		// Output element array
+		OutType* pOut;
+	};
+	
+	// Static templated method to perform a unary array operation on a range of elements
+	template <class UnaryOp, class OutType> static void arrayRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data and offset the pointers to the range start
+		ElemOpTask<ScalarType, OutType>* pTask = (ElemOpTask<ScalarType, OutType>*)pData;
+		const ScalarType* pIn = pTask->pInA + begin;
+		OutType* pOut = pTask->pOut + begin;
+		size_t numElems = end - begin;
+		
+		// If a vectorized kernel performs the operation, stop
+		if (ArrayKernel<UnaryOp, ScalarType, OutType>::unary(pIn, pOut, numElems))
+			return;
+		
+		// For each matrix element of the input and output matrices
+		for (size_t i = 0; i < numElems; ++i)
+		{
+			// Perform the operation
+			pOut[i] = (OutType)UnaryOp::op(pIn[i]);
+		}
+	}
+	
+	// Static templated method to perform a scalar lhs array operation on a range of elements
+	template <class BinaryOp, class OutType, class InScalarType> static void lhsScalarRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data and offset the pointers to the range start
+		ElemOpTask<InScalarType, OutType>* pTask = (ElemOpTask<InScalarType, OutType>*)pData;
+		const ScalarType* pIn = pTask->pInB + begin;
+		OutType* pOut = pTask->pOut + begin;
+		size_t numElems = end - begin;
+		
+		// If a vectorized kernel performs the operation, stop
+		if (ArrayKernel<BinaryOp, ScalarType, OutType>::binary(&pTask->scalarVal, true, pIn, false, pOut, numElems))
+			return;
+		
+		// For each matrix element of the input and output matrices
+		for (size_t i = 0; i < numElems; ++i)
+		{
+			// Perform the operation
+			pOut[i] = (OutType)BinaryOp::op(pTask->scalar, pIn[i]);
+		}
+	}
+	
+	// Static templated method to perform a scalar rhs array operation on a range of elements
+	template <class BinaryOp, class OutType, class InScalarType> static void rhsScalarRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data and offset the pointers to the range start
+		ElemOpTask<InScalarType, OutType>* pTask = (ElemOpTask<InScalarType, OutType>*)pData;
+		const ScalarType* pIn = pTask->pInA + begin;
+		OutType* pOut = pTask->pOut + begin;
+		size_t numElems = end - begin;
+		
+		// If a vectorized kernel performs the operation, stop
+		if (ArrayKernel<BinaryOp, ScalarType, OutType>::binary(pIn, false, &pTask->scalarVal, true, pOut, numElems))
+			return;
+		
+		// For each matrix element of the input and output matrices
+		for (size_t i = 0; i < numElems; ++i)
+		{
+			// Perform the operation
+			pOut[i] = (OutType)BinaryOp::op(pIn[i], pTask->scalar);
+		}
+	}
+	
+	// Static templated method to perform a binary array operation on a range of elements
+	template <class BinaryOp, class OutType> static void binArrayRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data and offset the pointers to the range start
+		ElemOpTask<ScalarType, OutType>* pTask = (ElemOpTask<ScalarType, OutType>*)pData;
+		const ScalarType* pInA = pTask->pInA + begin;
+		const ScalarType* pInB = pTask->pInB + begin;
+		OutType* pOut = pTask->pOut + begin;
+		size_t numElems = end - begin;
+		
+		// If a vectorized kernel performs the operation, stop
+		if (ArrayKernel<BinaryOp, ScalarType, OutType>::binary(pInA, false, pInB, false, pOut, numElems))
+			return;
+		
+		// For each matrix element of the input and output matrices
+		for (size_t i = 0; i < numElems; ++i)
+		{
+			// Perform the operation
+			pOut[i] = (OutType)BinaryOp::op(pInA[i], pInB[i]);
+		}
+	}
+	
 	// Static templated method to perform an array (per-element) operation on one matrix
 	template <class UnaryOp, class OutType> static MatrixObj<OutType>* arrayOp(const MatrixObj* pMatrix)
 	{
 		// Create a new matrix object to store the result
 		MatrixObj<OutType>* pResult = new MatrixObj<OutType>(pMatrix->m_size);
-			
-		// Compute a pointer to the last matrix element of the matrix
-		const ScalarType* pLastElem = pMatrix->m_pElements + pMatrix->m_numElements;
-			
-		// For each matrix element of the input and output matrices
-		ScalarType* pIn = pMatrix->m_pElements;
-		OutType* pOut = pResult->getElements();
-		for (; pIn < pLastElem; ++pIn, ++pOut)		
-		{
-			// Perform the exponentiation
-			*pOut = (OutType)UnaryOp::op(*pIn);
-		}
+		
+		// Perform the operation, split across the worker pool if large enough
+		ElemOpTask<ScalarType, OutType> task;
+		task.pInA = pMatrix->m_pElements;
+		task.pOut = pResult->getElements();
+		WorkerPool::parallelFor(pMatrix->m_numElements, 1, &arrayRange<UnaryOp, OutType>, &task);
 			
 		// Return a pointer to the result matrix
 		return pResult;
@@ -1637,17 +1841,13 @@ public:
 		// Create a new matrix object to store the result
 		MatrixObj<OutType>* pResult = new MatrixObj<OutType>(pMatrixR->m_size);
 		
-		// Compute a pointer to the last matrix element of the right matrix
-		const ScalarType* pLastElem = pMatrixR->m_pElements + pMatrixR->m_numElements;
-		
-		// For each matrix element of the input and output matrices
-		ScalarType* pIn = pMatrixR->m_pElements;
-		OutType* pOut = pResult->getElements();
-		for (; pIn < pLastElem; ++pIn, ++pOut)		
-		{
-			// Perform the exponentiation
-			*pOut = (OutType)BinaryOp::op(scalarL, *pIn);
-		}
+		// Perform the operation, split across the worker pool if large enough
+		ElemOpTask<InScalarType, OutType> task;
+		task.pInB = pMatrixR->m_pElements;
+		task.scalar = scalarL;
+		task.scalarVal = (ScalarType)scalarL;
+		task.pOut = pResult->getElements();
+		WorkerPool::parallelFor(pMatrixR->m_numElements, 1, &lhsScalarRange<BinaryOp, OutType, InScalarType>, &task);
 		
 		// Return a pointer to the result matrix
 		return pResult;
@@ -1659,17 +1859,13 @@ public:
 		// Create a new matrix object to store the result
 		MatrixObj<OutType>* pResult = new MatrixObj<OutType>(pMatrixL->m_size);
 		
-		// Compute a pointer to the last matrix element of the right matrix
-		const ScalarType* pLastElem = pMatrixL->m_pElements + pMatrixL->m_numElements;
-		
-		// For each matrix element of the input and output matrices
-		ScalarType* pIn = pMatrixL->m_pElements;
-		OutType* pOut = pResult->getElements();
-		for (; pIn < pLastElem; ++pIn, ++pOut)		
-		{
-			// Perform the exponentiation
-			*pOut = (OutType)BinaryOp::op(*pIn, scalarR);
-		}
+		// Perform the operation, split across the worker pool if large enough
+		ElemOpTask<InScalarType, OutType> task;
+		task.pInA = pMatrixL->m_pElements;
+		task.scalar = scalarR;
+		task.scalarVal = (ScalarType)scalarR;
+		task.pOut = pResult->getElements();
+		WorkerPool::parallelFor(pMatrixL->m_numElements, 1, &rhsScalarRange<BinaryOp, OutType, InScalarType>, &task);
 		
 		// Return a pointer to the result matrix
 		return pResult;
@@ -1702,126 +1898,150 @@ public:
 			// Create a new matrix object to store the result
 			MatrixObj<OutType>* pResult = new MatrixObj<OutType>(pMatrixA->m_size);
 			
-			// Compute a pointer to the last matrix element
-			const ScalarType* pLastElem = pMatrixA->m_pElements + pMatrixA->m_numElements;
-			
-			// For each matrix element of the input and output matrices
-			ScalarType* pInA = pMatrixA->m_pElements;
-			ScalarType* pInB = pMatrixB->m_pElements;
-			OutType* pOut = pResult->getElements();
-			for (; pInA < pLastElem; ++pInA, ++pInB, ++pOut)		
-			{
-				// Perform the exponentiation
-				*pOut = (OutType)BinaryOp::op(*pInA, *pInB);
-			}		
+			// Perform the operation, split across the worker pool if large enough
+			ElemOpTask<ScalarType, OutType> task;
+			task.pInA = pMatrixA->m_pElements;
+			task.pInB = pMatrixB->m_pElements;
+			task.pOut = pResult->getElements();
+			WorkerPool::parallelFor(pMatrixA->m_numElements, 1, &binArrayRange<BinaryOp, OutType>, &task);
 			
 			// Return a pointer to the result matrix
 			return pResult;
 		}
 	}
 
+	// Number of output vectors accumulated together by strided reductions
+	static const size_t VECTOR_BLOCK_SIZE = 256;
+	
+	// Task data for a vector (per-vector) operation on a range of work items
+	template <class OutType> struct VectorOpTask
+	{
+		// Input matrix elements
+		const ScalarType* pIn;
+		
+		// Output element array
+		OutType* pOut;
+		
+		// Length and stride of the operating dimension
+		size_t opDimLength;
+		size_t opDimStride;
+		
+		// Number of output blocks per slab of the input
+		size_t numBlocks;
+	};
+	
+	// Static templated method to reduce a range of contiguous vectors
+	template <class VectorOp, class OutType> static void vectorRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data
+		VectorOpTask<OutType>* pTask = (VectorOpTask<OutType>*)pData;
+		size_t vecLength = pTask->opDimLength;
+		
+		// For each vector in the range
+		for (size_t outIndex = begin; outIndex < end; ++outIndex)
+		{
+			// Compute the vector start address
+			const ScalarType* pVec = pTask->pIn + outIndex * vecLength;
+			
+			// Accumulate the vector elements in order, stopping once the result is known
+			typename VectorOp::AccType acc = VectorOp::init();
+			for (size_t i = 0; i < vecLength; ++i)
+				if (VectorOp::accum(acc, pVec[i])) break;
+			
+			// Store the result of the operation
+			pTask->pOut[outIndex] = (OutType)VectorOp::result(acc, vecLength);
+		}
+	}
+	
+	// Static templated method to reduce a range of blocks of strided vectors
+	template <class VectorOp, class OutType> static void vectorBlockRange(void* pData, size_t begin, size_t end)
+	{
+		// Get the task data
+		VectorOpTask<OutType>* pTask = (VectorOpTask<OutType>*)pData;
+		size_t vecLength = pTask->opDimLength;
+		size_t stride = pTask->opDimStride;
+		
+		// Accumulators for the vectors of one block
+		typename VectorOp::AccType accs[VECTOR_BLOCK_SIZE];
+		
+		// For each block in the range
+		for (size_t item = begin; item < end; ++item)
+		{
+			// Get the slab and the vectors this block covers
+			size_t slab = item / pTask->numBlocks;
+			size_t blockStart = (item % pTask->numBlocks) * VECTOR_BLOCK_SIZE;
+			size_t blockLength = std::min(stride - blockStart, (size_t)VECTOR_BLOCK_SIZE);
+			
+			// Compute the address of the first element of the block
+			const ScalarType* pBlock = pTask->pIn + slab * vecLength * stride + blockStart;
+			
+			// Initialize the accumulators
+			for (size_t j = 0; j < blockLength; ++j)
+				accs[j] = VectorOp::init();
+			
+			// Walk along the operating dimension, reading one contiguous
+			// run of elements per step, so that each vector is still
+			// accumulated in the same order as a sequential traversal
+			for (size_t i = 0; i < vecLength; ++i)
+			{
+				const ScalarType* pRow = pBlock + i * stride;
+				for (size_t j = 0; j < blockLength; ++j)
+					VectorOp::accum(accs[j], pRow[j]);
+			}
+			
+			// Store the results of the operation
+			OutType* pOut = pTask->pOut + slab * stride + blockStart;
+			for (size_t j = 0; j < blockLength; ++j)
+				pOut[j] = (OutType)VectorOp::result(accs[j], vecLength);
+		}
+	}
+
 	// Static templated method to perform a vector (per-vector) operation on a matrix
 	template <class VectorOp, class OutType> static MatrixObj<OutType>* vectorOp(const MatrixObj* pInMatrix, size_t opDim)
 	{
-		// Ensure the operating dimension is valid
-		assert (opDim < pInMatrix->m_size.size());
-		
 		// If the input matrix is empty, return an empty matrix
 		if (pInMatrix->isEmpty())
 			return new MatrixObj<OutType>(pInMatrix->getSize());
 		
-		// Get the operating dimension length
-		size_t opDimLength = pInMatrix->m_size[opDim];
+		// Get the operating dimension length, dimensions past
+		// the last one are singular
+		size_t opDimLength = (opDim < pInMatrix->m_size.size())? pInMatrix->m_size[opDim]:1;
 		
 		// Compute the stride along the operating dimension
 		size_t opDimStride = 1;
-		for (size_t i = 0; i < opDim; ++i)
+		for (size_t i = 0; i < opDim && i < pInMatrix->m_size.size(); ++i)
 			opDimStride *=  pInMatrix->m_size[i];
 		
 		// Compute the size of the output matrix
 		DimVector outSize = pInMatrix->m_size;
-		outSize[opDim] = 1;
+		if (opDim < outSize.size())
+			outSize[opDim] = 1;
 		
 		// Create a new matrix to store the output
 		MatrixObj<OutType>* pOutMatrix = new MatrixObj<OutType>(outSize);
-			
-		// Initialize the output pointer
-		OutType* pOut = pOutMatrix->getElements();
 		
-		// Create and initialize a vector for the indices
-		DimVector indices(pInMatrix->m_size.size(), 0);
+		// Compute the number of slabs, each holding the vectors
+		// of one index above the operating dimension
+		size_t numSlabs = pInMatrix->m_numElements / (opDimLength * opDimStride);
 		
-		// Initialize the current dimension index
-		size_t curDim = 0;
+		// Set up the task data
+		VectorOpTask<OutType> task;
+		task.pIn = pInMatrix->m_pElements;
+		task.pOut = pOutMatrix->getElements();
+		task.opDimLength = opDimLength;
+		task.opDimStride = opDimStride;
+		task.numBlocks = (opDimStride + VECTOR_BLOCK_SIZE - 1) / VECTOR_BLOCK_SIZE;
 		
-		// For each vector
-		for (;;)
-		{				
-			// Compute the current vector index
-			size_t index = 0;
-			size_t offset = 1;
-			for (size_t i = 0; i < indices.size(); ++i)
-			{
-				index += indices[i] * offset;
-				offset *= pInMatrix->m_size[i];
-			}
-			
-			// Compute the vector start and end addresses
-			ScalarType* pVecStart = pInMatrix->m_pElements + index;
-			ScalarType* pVecEnd = pVecStart + (opDimLength * opDimStride);
-			
-			// Restrict the vector end to be within the matrix boundary
-			pVecEnd = std::min(pVecEnd, pInMatrix->m_pElements + pInMatrix->m_numElements);
-			
-			// Ensure that the output pointer is valid
-			assert (pOut < pOutMatrix->getElements() + pOutMatrix->getNumElems());
-			
-			// Perform the operation on this vector
-			*pOut = (OutType)VectorOp::op(pVecStart, pVecEnd, opDimStride);
-			
-			// Increment the output pointer
-			++pOut;
-
-			// Until we are done moving to the next slice
-			while (curDim < indices.size())
-			{
-				// If this is the operating dimension
-				if (curDim == opDim)
-				{
-					// Move to the next dimension
-					curDim++;
-					
-					// If the current dimension is no longer valid, stop the process
-					if (curDim >= indices.size())
-						break;
-				}
-	
-				// Move to the next index along this dimension
-				indices[curDim]++;
-				
-				// If the index along this dimension is still valid
-				if (indices[curDim] < pInMatrix->m_size[curDim])
-				{
-					// Go back to the first dimension
-					curDim = 0;
-					
-					// Stop the process
-					break;
-				}
-				else
-				{
-					// Move to the next dimension
-					curDim++;
-					
-					// Reset the indices for prior dimensions
-					for (size_t i = 0; i < curDim; ++i)
-						indices[i] = 0;
-				}				
-			}
-			
-			// If there are no more indices, stop
-			if (curDim >= indices.size())
-				break;
+		// If the vectors are contiguous, reduce them one at a time
+		if (opDimStride == 1)
+		{
+			WorkerPool::parallelFor(numSlabs, opDimLength, &vectorRange<VectorOp, OutType>, &task);
+		}
+		
+		// Otherwise, reduce blocks of neighboring vectors together
+		else
+		{
+			WorkerPool::parallelFor(numSlabs * task.numBlocks, opDimLength * std::min(opDimStride, (size_t)VECTOR_BLOCK_SIZE), &vectorBlockRange<VectorOp, OutType>, &task);
 		}
 		
 		// Return the output matrix
@@ -1977,7 +2197,7 @@ public:
 			pMatrix->expand(DimVector(1, index));
 		}
 		
-		// Get a pointer to the matrix data
+		// Get a pointer to the matrix data, copying the elements if they are shared
 		ScalarType* pData = pMatrix->getElements();
 		
 		// Write the element at the index
@@ -2011,7 +2231,7 @@ public:
 			offset = zeroIndex2 * pMatrix->m_size[0] + zeroIndex1;
 		}
 		
-		// Get a pointer to the matrix data
+		// Get a pointer to the matrix data, copying the elements if they are shared
 		ScalarType* pData = pMatrix->getElements();
 		
 		// Write the element at the offset
@@ -2051,8 +2271,9 @@ public:
 	// Accessor to access the matrix elements of a constant matrix
 	const ScalarType* getElements() const { return m_pElements; }
 	
-	// Accessors to access the matrix elements
-	ScalarType* getElements() { return m_pElements; }
+	// Accessor to access the matrix elements for writing, this gives
+	// the matrix its own copy of the elements if they are shared
+	ScalarType* getElements() { unshare(); return m_pElements; }
 
 	// Static method to get the first element of a matrix
 	static ScalarType getScalarVal(const MatrixObj* pMatrix) { return pMatrix->getScalar(); }
@@ -2081,9 +2302,21 @@ protected:
 		for (size_t i = 1; i < m_size.size(); ++i)
 			m_numElements *= m_size[i];
 		
+		// Scalars store their element inside the object, so that
+		// boxing a scalar value takes a single allocation
+		if (m_numElements == 1)
+		{
+			m_pElements = &m_scalarElem;
+			return;
+		}
+		
 		// Allocate memory for the matrix elements
 		// Note that the memory is garbage-collected
 		m_pElements = (ScalarType*)GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(m_numElements * sizeof(ScalarType));
+		
+		// Update the matrix buffer allocation counters
+		PROF_INCR_COUNTER(Profiler::MATRIX_BUF_ALLOC_COUNT);
+		PROF_ADD_COUNTER(Profiler::MATRIX_BUF_ALLOC_BYTES, m_numElements * sizeof(ScalarType));
 	}
 	
 	// Method to initialize the matrix
@@ -2103,6 +2336,15 @@ protected:
 	// Array of matrix element
 	// Note: the elements are stored in column-major order
 	ScalarType* m_pElements;
+	
+	// Inline storage for the element of a scalar matrix
+	ScalarType m_scalarElem;
+	
+	// Flag indicating the elements may be shared with another matrix
+	mutable bool m_shared;
+	
+	// Cached all-integer flag, computed lazily and reset on writes
+	mutable char m_intFlag;
 };
 
 // Template specialization of the class type method for common matrix object types
@@ -2117,6 +2359,9 @@ template <> inline DataObject::Type MatrixObj<DataObject*>::getClassType() { ret
 template <> DataObject* MatrixObj<Complex128>::convert(DataObject::Type outType) const;
 template <> DataObject* MatrixObj<DataObject*>::convert(DataObject::Type outType) const;
 
+// Template specialization of the all-integer test method
+template <> bool MatrixObj<float64>::isAllInteger() const;
+
 // Template specialization of the matrix multiplication method
 template <> MatrixObj<float64>* MatrixObj<float64>::matrixMult(const MatrixObj* pMatrixA, const MatrixObj* pMatrixB);
 template <> MatrixObj<Complex128>* MatrixObj<Complex128>::matrixMult(const MatrixObj* pMatrixA, const MatrixObj* pMatrixB);
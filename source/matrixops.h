@@ -22,6 +22,8 @@
 
 // Header files
 #include <cmath>
+#include <limits>
+#include <algorithm>
 #include "runtimebase.h"
 #include "chararrayobj.h"
 #include "utility.h"
@@ -600,19 +602,22 @@ template <class ScalarType> class SumOp
 {
 public:
 	
-	// Function operator
-	static ScalarType op(ScalarType* pVecStart, ScalarType* pVecEnd, size_t vecStride)
+	// Accumulator type
+	typedef ScalarType AccType;
+	
+	// Initial accumulator value
+	static AccType init() { return 0; }
+	
+	// Accumulate a vector element, returns true once the result is known
+	static bool accum(AccType& acc, ScalarType in)
 	{
-		// Initialize the sum to 0
-		ScalarType sum = 0;
-		
-		// Sum all the vector elements
-		for (ScalarType* pIn = pVecStart; pIn < pVecEnd; pIn += vecStride)
-			sum += *pIn;		
-		
-		// Return the sum
-		return sum;
+		// Add the element to the sum
+		acc += in;
+		return false;
 	}
+	
+	// Compute the result from the accumulator
+	static AccType result(AccType acc, size_t vecLength) { return acc; }
 };
 
 /***************************************************************
@@ -626,16 +631,109 @@ template <class ScalarType> class AnyOp
 {
 public:
 	
-	// Function operator
-	static bool op(ScalarType* pVecStart, ScalarType* pVecEnd, size_t vecStride)
-	{		
-		// If any element is nonzero, return true
-		for (ScalarType* pIn = pVecStart; pIn < pVecEnd; pIn += vecStride)
-			if (*pIn) return true;
-		
-		// No nonzero elements found, return false
+	// Accumulator type
+	typedef bool AccType;
+	
+	// Initial accumulator value
+	static AccType init() { return false; }
+	
+	// Accumulate a vector element, returns true once the result is known
+	static bool accum(AccType& acc, ScalarType in)
+	{
+		// If the element is nonzero, the result is true
+		if (in) acc = true;
+		return acc;
+	}
+	
+	// Compute the result from the accumulator
+	static AccType result(AccType acc, size_t vecLength) { return acc; }
+};
+
+/***************************************************************
+* Class   : MeanOp
+* Purpose : Function object for the mean operator
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> class MeanOp
+{
+public:
+	
+	// Accumulator type
+	typedef ScalarType AccType;
+	
+	// Initial accumulator value
+	static AccType init() { return 0; }
+	
+	// Accumulate a vector element, returns true once the result is known
+	static bool accum(AccType& acc, ScalarType in)
+	{
+		// Add the element to the sum
+		acc += in;
+		return false;
+	}
+	
+	// Compute the result from the accumulator
+	static AccType result(AccType acc, size_t vecLength) { return acc / (ScalarType)vecLength; }
+};
+
+/***************************************************************
+* Class   : MaxVecOp
+* Purpose : Function object for the vector maximum operator
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> class MaxVecOp
+{
+public:
+	
+	// Accumulator type
+	typedef ScalarType AccType;
+	
+	// Initial accumulator value
+	static AccType init() { return -std::numeric_limits<ScalarType>::infinity(); }
+	
+	// Accumulate a vector element, returns true once the result is known
+	static bool accum(AccType& acc, ScalarType in)
+	{
+		// Keep the largest value
+		acc = std::max(acc, in);
 		return false;
 	}
+	
+	// Compute the result from the accumulator
+	static AccType result(AccType acc, size_t vecLength) { return acc; }
+};
+
+/***************************************************************
+* Class   : MinVecOp
+* Purpose : Function object for the vector minimum operator
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> class MinVecOp
+{
+public:
+	
+	// Accumulator type
+	typedef ScalarType AccType;
+	
+	// Initial accumulator value
+	static AccType init() { return std::numeric_limits<ScalarType>::infinity(); }
+	
+	// Accumulate a vector element, returns true once the result is known
+	static bool accum(AccType& acc, ScalarType in)
+	{
+		// Keep the smallest value
+		acc = std::min(acc, in);
+		return false;
+	}
+	
+	// Compute the result from the accumulator
+	static AccType result(AccType acc, size_t vecLength) { return acc; }
 };
 
 /***************************************************************
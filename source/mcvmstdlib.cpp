@@ -932,16 +932,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Apply the ceil function to this element
 				*pOut = ::ceil(*pIn);
@@ -1126,16 +1129,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Compute the sine of this element
 				*pOut = ::cos(*pIn);
@@ -1378,8 +1384,8 @@ namespace mcvm { namespace stdlib {
 		if (pArg0->getType() == DataObject::MATRIX_F64 && pArg1->getType() == DataObject::MATRIX_F64)
 		{			
 			// Get a typed pointer to the arguments
-			MatrixF64Obj* pMatrix0 = (MatrixF64Obj*)pArg0;
-			MatrixF64Obj* pMatrix1 = (MatrixF64Obj*)pArg1;
+			const MatrixF64Obj* pMatrix0 = (const MatrixF64Obj*)pArg0;
+			const MatrixF64Obj* pMatrix1 = (const MatrixF64Obj*)pArg1;
 
 			// Ensure that the matrix dimensions match
 			if (pMatrix0->getNumElems() != pMatrix1->getNumElems())
@@ -1417,11 +1423,14 @@ namespace mcvm { namespace stdlib {
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(outSize);
 				
 			// Compute a pointer past the last element of the input matrix
-			float64* pLastElem = pMatrix0->getElements() + pMatrix0->getNumElems();
+			const float64* pLastElem = pMatrix0->getElements() + pMatrix0->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each vector inside the input matrices
 			for (
-				float64 *pVec0 = pMatrix0->getElements(), *pVec1 = pMatrix1->getElements(), *pOut = pOutMatrix->getElements();
+				const float64 *pVec0 = pMatrix0->getElements(), *pVec1 = pMatrix1->getElements();
 				pVec0 < pLastElem;
 				pVec0 += firstDimLen, pVec1 += firstDimLen, ++pOut
 			)
@@ -1430,10 +1439,10 @@ namespace mcvm { namespace stdlib {
 				float64 sum = 0;
 				
 				// Compute a pointer past the last element of this vector
-				float64* pLastInVec = pVec0 + firstDimLen;
+				const float64* pLastInVec = pVec0 + firstDimLen;
 				
 				// Add all vector element products to the sum
-				for (float64 *pIn0 = pVec0, *pIn1 = pVec1; pIn0 < pLastInVec; ++pIn0, ++pIn1)
+				for (const float64 *pIn0 = pVec0, *pIn1 = pVec1; pIn0 < pLastInVec; ++pIn0, ++pIn1)
 					sum += (*pIn0) * (*pIn1);
 				
 				// Store the sum in the output
@@ -1912,16 +1921,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Apply the floor function to this element
 				*pOut = ::floor(*pIn);
@@ -1959,16 +1971,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Apply the floor function to this element
 				*pOut = ::floor(*pIn);
@@ -2188,7 +2203,7 @@ namespace mcvm { namespace stdlib {
 			throw RunError("arguments must be matrices");
 		
 		// Get a reference to the first matrix
-		MatrixF64Obj* pPrevMatrix = (MatrixF64Obj*)pArguments->getObject(0);
+		const MatrixF64Obj* pPrevMatrix = (const MatrixF64Obj*)pArguments->getObject(0);
 		
 		// For each subsequent matrix
 		for (size_t i = 1; i < pArguments->getSize(); ++i)
@@ -2198,7 +2213,7 @@ namespace mcvm { namespace stdlib {
 				throw RunError("arguments must be matrices");
 		
 			// Get a reference to this matrix
-			MatrixF64Obj* pCurrentMatrix = (MatrixF64Obj*)pArguments->getObject(i);
+			const MatrixF64Obj* pCurrentMatrix = (const MatrixF64Obj*)pArguments->getObject(i);
 
 			// If the matrix sizes do not match, return false
 			if (pCurrentMatrix->getSize() != pPrevMatrix->getSize())
@@ -2420,16 +2435,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// If the value is negative
 				if (*pIn < 0)
@@ -2512,52 +2530,12 @@ namespace mcvm { namespace stdlib {
 				if (pInMatrix->isEmpty() || pInMatrix->isScalar())
 					return new ArrayObj(pInMatrix->copy());
 				
-				// Get the size of the input matrix
-				const DimVector& inSize = pInMatrix->getSize();
-				
-				// Declare variables to store the index and length of the first non-singular dimension
-				size_t firstDim = 0;
-				size_t firstDimLen = 0;
-				
-				// For each dimension
-				for (size_t i = 0; i < inSize.size(); ++i)
-				{
-					// If this dimension is non-singular
-					if (inSize[i] > 1)
-					{
-						// Store its index and length, then break out of this loop
-						firstDim = i;
-						firstDimLen = inSize[i];
-						break;
-					}
-				}
-				
-				// Compute the size of the output matrix
-				DimVector outSize = inSize;
-				outSize[firstDim] = 1;			
+				// Get the operating dimension
+				size_t opDim;
+				parseVectorArgs(pArguments, opDim);
 				
-				// Create a new matrix to store the output
-				MatrixF64Obj* pOutMatrix = new MatrixF64Obj(outSize);
-					
-				// Compute a pointer past the last element of the input matrix
-				float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
-				
-				// For each vector inside the input matrix
-				for (float64 *pVec = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pVec < pLastElem; pVec += firstDimLen, ++pOut)
-				{
-					// Initialize max value to negative infiity
-					float64 max = -FLOAT_INFINITY;
-					
-					// Compute a pointer past the last element of this vector
-					float64* pLastInVec = pVec + firstDimLen;
-					
-					// Find the max element in the vector
-					for (float64* pIn = pVec; pIn < pLastInVec; ++pIn)
-						max = std::max(max, *pIn);				
-					
-					// Store the max value in the output
-					*pOut = max;
-				}		
+				// Perform the vector operation to get the result
+				MatrixF64Obj* pOutMatrix = MatrixF64Obj::vectorOp<MaxVecOp<float64>, float64>(pInMatrix, opDim);
 	
 				// Return the output matrix
 				return new ArrayObj(pOutMatrix);
@@ -2648,12 +2626,9 @@ namespace mcvm { namespace stdlib {
 	*/
 	ArrayObj* meanFunc(ArrayObj* pArguments)
 	{
-		// Ensure there is one argument
-		if (pArguments->getSize() != 1)
-			throw RunError("invalid argument count");
-	
-		// Get a pointer to the argument
-		DataObject* pArgument = pArguments->getObject(0);
+		// Parse the input arguments
+		size_t opDim;
+		DataObject* pArgument = parseVectorArgs(pArguments, opDim);
 
 		// If the argument is not a 64-bit float matrix, convert its type
 		if (pArgument->getType() != DataObject::MATRIX_F64)
@@ -2666,52 +2641,8 @@ namespace mcvm { namespace stdlib {
 		if (pInMatrix->isEmpty() || pInMatrix->isScalar())
 			return new ArrayObj(pInMatrix->copy());
 		
-		// Get the size of the input matrix
-		const DimVector& inSize = pInMatrix->getSize();
-		
-		// Declare variables to store the index and length of the first non-singular dimension
-		size_t firstDim = 0;
-		size_t firstDimLen = 0;
-		
-		// For each dimension
-		for (size_t i = 0; i < inSize.size(); ++i)
-		{
-			// If this dimension is non-singular
-			if (inSize[i] > 1)
-			{
-				// Store its index and length, then break out of this loop
-				firstDim = i;
-				firstDimLen = inSize[i];
-				break;
-			}
-		}
-		
-		// Compute the size of the output matrix
-		DimVector outSize = inSize;
-		outSize[firstDim] = 1;			
-		
-		// Create a new matrix to store the output
-		MatrixF64Obj* pOutMatrix = new MatrixF64Obj(outSize);
-			
-		// Compute a pointer past the last element of the input matrix
-		float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
-		
-		// For each vector inside the input matrix
-		for (float64 *pVec = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pVec < pLastElem; pVec += firstDimLen, ++pOut)
-		{
-			// Initialize the sum to 0
-			float64 meanSum = 0;
-			
-			// Compute a pointer past the last element of this vector
-			float64* pLastInVec = pVec + firstDimLen;
-			
-			// Add all vector elements to the mean sum
-			for (float64* pIn = pVec; pIn < pLastInVec; ++pIn)
-				meanSum += *pIn;				
-			
-			// Normalize the mean sum
-			*pOut = meanSum / firstDimLen;
-		}		
+		// Perform the vector operation to get the result
+		MatrixF64Obj* pOutMatrix = MatrixF64Obj::vectorOp<MeanOp<float64>, float64>(pInMatrix, opDim);
 
 		// Return the output matrix
 		return new ArrayObj(pOutMatrix);
@@ -2742,52 +2673,12 @@ namespace mcvm { namespace stdlib {
 				if (pInMatrix->isEmpty() || pInMatrix->isScalar())
 					return new ArrayObj(pInMatrix->copy());
 				
-				// Get the size of the input matrix
-				const DimVector& inSize = pInMatrix->getSize();
-				
-				// Declare variables to store the index and length of the first non-singular dimension
-				size_t firstDim = 0;
-				size_t firstDimLen = 0;
+				// Get the operating dimension
+				size_t opDim;
+				parseVectorArgs(pArguments, opDim);
 				
-				// For each dimension
-				for (size_t i = 0; i < inSize.size(); ++i)
-				{
-					// If this dimension is non-singular
-					if (inSize[i] > 1)
-					{
-						// Store its index and length, then break out of this loop
-						firstDim = i;
-						firstDimLen = inSize[i];
-						break;
-					}
-				}
-				
-				// Compute the size of the output matrix
-				DimVector outSize = inSize;
-				outSize[firstDim] = 1;			
-				
-				// Create a new matrix to store the output
-				MatrixF64Obj* pOutMatrix = new MatrixF64Obj(outSize);
-					
-				// Compute a pointer past the last element of the input matrix
-				float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
-				
-				// For each vector inside the input matrix
-				for (float64 *pVec = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pVec < pLastElem; pVec += firstDimLen, ++pOut)
-				{
-					// Initialize min value to infiity
-					float64 min = FLOAT_INFINITY;
-					
-					// Compute a pointer past the last element of this vector
-					float64* pLastInVec = pVec + firstDimLen;
-					
-					// Find the min element in the vector
-					for (float64* pIn = pVec; pIn < pLastInVec; ++pIn)
-						min = std::min(min, *pIn);				
-					
-					// Store the min value in the output
-					*pOut = min;
-				}		
+				// Perform the vector operation to get the result
+				MatrixF64Obj* pOutMatrix = MatrixF64Obj::vectorOp<MinVecOp<float64>, float64>(pInMatrix, opDim);
 	
 				// Return the output matrix
 				return new ArrayObj(pOutMatrix);
@@ -3253,7 +3144,7 @@ namespace mcvm { namespace stdlib {
 		if (pSrcMatrix->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the input matrix
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pSrcMatrix;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pSrcMatrix;
 			
 			// Create a matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(dstSize);
@@ -3380,16 +3271,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer past the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element inside the input matrix
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Round the value
 				*pOut = ::round(*pIn);
@@ -3464,16 +3358,19 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Create a new matrix to store the output
 			MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pInMatrix->getSize());
 			
 			// Compute a pointer to the last element of the input matrix
-			float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			const float64* pLastElem = pInMatrix->getElements() + pInMatrix->getNumElems();
+			
+			// Get a pointer to the output elements
+			float64* pOut = pOutMatrix->getElements();
 			
 			// For each element of the matrices
-			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
+			for (const float64* pIn = pInMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
 				// Compute the sine of this element
 				*pOut = ::sin(*pIn);
@@ -3780,7 +3677,7 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// Get the input matrix size
 			const DimVector& inSize = pInMatrix->getSize();
@@ -4468,7 +4365,7 @@ namespace mcvm { namespace stdlib {
 		if (pArgument->getType() == DataObject::MATRIX_F64)
 		{			
 			// Get a typed pointer to the argument
-			MatrixF64Obj* pInMatrix = (MatrixF64Obj*)pArgument;
+			const MatrixF64Obj* pInMatrix = (const MatrixF64Obj*)pArgument;
 			
 			// If the input matrix is empty, return a copy of it
 			if (pInMatrix->isEmpty())
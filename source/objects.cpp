@@ -76,9 +76,10 @@ std::string DataObject::getTypeName(Type type)
 }
 
 // Static version of the copy method
+// Note: matrix copies share their elements until written to, so the
+// array copy count is incremented when the elements are actually copied
 DataObject* DataObject::copyObject(const DataObject* pObject)
 { 
-	PROF_INCR_COUNTER(Profiler::ARRAY_COPY_COUNT); 
 	return pObject->copy();
 }
 	
@@ -40,7 +40,7 @@ public:
 	
 	// Constructor
 	ParamExpr(SymbolExpr* symExpr, const ExprVector& arguments)
-	: m_pSymbolExpr(symExpr), m_arguments(arguments)
+	: m_pSymbolExpr(symExpr), m_arguments(arguments), m_pCallCache(NULL)
 	{ m_exprType = PARAM; }
 	
 	// Method to recursively copy this node
@@ -61,6 +61,11 @@ public:
 	// Accessor to get the arguments
 	const ExprVector& getArguments() const { return m_arguments; }
 	
+	// Accessors to get and set the call site cache of this expression
+	// NOTE: the cache is owned by the JIT compiler and opaque to the IIR
+	void* getCallCache() const { return m_pCallCache; }
+	void setCallCache(void* pCallCache) const { m_pCallCache = pCallCache; }
+	
 protected:
 	
 	// Symbol expression
@@ -68,6 +73,9 @@ protected:
 	
 	// Function arguments
 	ExprVector m_arguments;
+	
+	// Call site cache for the calls made by this expression
+	mutable void* m_pCallCache;
 };
 
 #endif // #ifndef PARAMEXPR_H_
@@ -0,0 +1,254 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "parsecache.h"
+#include "profiling.h"
+#include "utility.h"
+#include "client.h"
+
+// Config variable to enable/disable the parse cache
+ConfigVar ParseCache::s_enableVar("parse_cache_enable", ConfigVar::BOOL, "false");
+
+// Config variable for the cache directory (empty for the default)
+ConfigVar ParseCache::s_dirVar("parse_cache_dir", ConfigVar::STRING, "");
+
+// Cache entry header signature
+const char ParseCache::ENTRY_SIGNATURE[] = "MCVMPC02";
+
+// Version of the XML IR produced by the code parser's frontend
+// NOTE: this must be changed whenever the expected IR changes
+const char ParseCache::IR_FORMAT_VERSION[] = "natlab xml ir 1";
+
+// Hash of the IR format and frontend versions of this run
+uint64 ParseCache::s_formatVersion = 0;
+
+// Size of the cache entry signature
+static const size_t ENTRY_SIGNATURE_SIZE = 8;
+
+/***************************************************************
+* Function: ParseCache::initialize()
+* Purpose : Initialize the parse cache
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ParseCache::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_enableVar);
+	ConfigManager::registerVar(&s_dirVar);
+	
+	// Identify the IR format and the installed frontend, so that
+	// entries produced by another frontend version are not used
+	std::string versionText = std::string(IR_FORMAT_VERSION) + "\n" + Client::getFrontendVersion();
+	s_formatVersion = hashBytes(versionText.data(), versionText.length());
+}
+
+/***************************************************************
+* Function: ParseCache::getFileKey()
+* Purpose : Compute the cache key for a source file
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool ParseCache::getFileKey(const std::string& filePath, FileKey& key)
+{
+	// Get the file status information
+	struct stat fileStat;
+	if (stat(filePath.c_str(), &fileStat) != 0)
+		return false;
+
+	// Read the file contents
+	std::string contents;
+	if (!readBinaryFile(filePath, contents))
+		return false;
+
+	// Fill in the key fields
+	key.contentHash = hashBytes(contents.data(), contents.length());
+	key.modTime = fileStat.st_mtime;
+	key.fileSize = contents.length();
+	key.formatVersion = s_formatVersion;
+
+	// The key was computed successfully
+	return true;
+}
+
+/***************************************************************
+* Function: ParseCache::lookup()
+* Purpose : Look up the cached XML IR tree for a source file
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+XML::Element* ParseCache::lookup(const std::string& filePath, const FileKey& key)
+{
+	// If the cache is disabled, do nothing
+	if (s_enableVar.getBoolValue() == false)
+		return NULL;
+
+	// Attempt to read the cache entry for this file
+	std::string entry;
+	bool found = readBinaryFile(getEntryPath(filePath), entry);
+
+	// Compute the size of the entry header
+	size_t headerSize = ENTRY_SIGNATURE_SIZE + 5 * sizeof(uint64);
+
+	// If the entry is present and its header is complete
+	if (found && entry.length() >= headerSize && entry.compare(0, ENTRY_SIGNATURE_SIZE, ENTRY_SIGNATURE) == 0)
+	{
+		// Read the key fields stored in the header
+		size_t charIndex = ENTRY_SIGNATURE_SIZE;
+		uint64 contentHash = readUInt64(entry, charIndex);
+		uint64 modTime = readUInt64(entry, charIndex);
+		uint64 fileSize = readUInt64(entry, charIndex);
+		uint64 formatVersion = readUInt64(entry, charIndex);
+		uint64 pathLength = readUInt64(entry, charIndex);
+
+		// If the entry matches this version of this file
+		if (contentHash == key.contentHash &&
+			modTime == key.modTime &&
+			fileSize == key.fileSize &&
+			formatVersion == key.formatVersion &&
+			pathLength <= entry.length() - charIndex &&
+			entry.compare(charIndex, pathLength, filePath) == 0)
+		{
+			// Move past the file path
+			charIndex += pathLength;
+
+			// Setup a try block to catch corrupted entries
+			try
+			{
+				// Decode the XML IR tree
+				XML::Element* pTree = XML::decodeBinary(entry.substr(charIndex));
+
+				// If the verbose output flag is set
+				if (ConfigManager::s_verboseVar.getBoolValue() == true)
+				{
+					// Log the cache hit
+					std::cout << "Parse cache hit: \"" << filePath << "\"" << std::endl;
+				}
+
+				// Increment the cache hit count
+				PROF_INCR_COUNTER(Profiler::PARSE_CACHE_HIT_COUNT);
+
+				// Return the decoded tree
+				return pTree;
+			}
+
+			// If the entry could not be decoded
+			catch (XML::ParseError error)
+			{
+				// Log the error
+				std::cout << "WARNING: corrupted parse cache entry for \"" << filePath << "\" " << error.toString() << std::endl;
+			}
+		}
+	}
+
+	// Increment the cache miss count
+	PROF_INCR_COUNTER(Profiler::PARSE_CACHE_MISS_COUNT);
+
+	// No valid entry was found
+	return NULL;
+}
+
+/***************************************************************
+* Function: ParseCache::store()
+* Purpose : Store the XML IR tree for a source file
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ParseCache::store(const std::string& filePath, const FileKey& key, const XML::Element* pTree)
+{
+	// Ensure that the tree is valid
+	assert (pTree != NULL);
+
+	// If the cache is disabled, do nothing
+	if (s_enableVar.getBoolValue() == false)
+		return;
+
+	// Get the path of the cache entry
+	std::string entryPath = getEntryPath(filePath);
+
+	// Build the entry header with the key fields and the file path
+	std::string entry(ENTRY_SIGNATURE, ENTRY_SIGNATURE_SIZE);
+	appendUInt64(entry, key.contentHash);
+	appendUInt64(entry, key.modTime);
+	appendUInt64(entry, key.fileSize);
+	appendUInt64(entry, key.formatVersion);
+	appendUInt64(entry, filePath.length());
+	entry += filePath;
+
+	// Append the binary-encoded tree
+	entry += XML::encodeBinary(pTree);
+
+	// Write the entry, if it could not be written
+	if (!writeCacheEntry(entryPath, entry))
+	{
+		// If the verbose output flag is set
+		if (ConfigManager::s_verboseVar.getBoolValue() == true)
+			std::cout << "Could not write parse cache entry: \"" << entryPath << "\"" << std::endl;
+	}
+}
+
+/***************************************************************
+* Function: ParseCache::getEntryPath()
+* Purpose : Get the cache entry path for a source file
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string ParseCache::getEntryPath(const std::string& filePath)
+{
+	// Name the entry after the hash of the file path
+	return getCacheEntryPath(
+		s_dirVar.getStringValue(),
+		hashBytes(filePath.data(), filePath.length()),
+		".mxb"
+	);
+}
+
+/***************************************************************
+* Function: ParseCache::hashBytes()
+* Purpose : Compute a 64-bit hash of a byte buffer
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+uint64 ParseCache::hashBytes(const char* pData, size_t length)
+{
+	// Use the 64-bit FNV-1a hash function
+	uint64 hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < length; ++i)
+	{
+		hash ^= (unsigned char)pData[i];
+		hash *= 1099511628211ULL;
+	}
+
+	// Return the hash value
+	return hash;
+}
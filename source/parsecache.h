@@ -0,0 +1,95 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef PARSECACHE_H_
+#define PARSECACHE_H_
+
+// Header files
+#include <string>
+#include "platform.h"
+#include "configmanager.h"
+#include "xml.h"
+
+/***************************************************************
+* Class   : ParseCache
+* Purpose : Persistent on-disk cache of parsed source files
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class ParseCache
+{
+public:
+	
+	// Source file key structure
+	struct FileKey
+	{
+		// Hash of the file contents
+		uint64 contentHash;
+		
+		// Last modification time of the file
+		uint64 modTime;
+		
+		// Size of the file in bytes
+		uint64 fileSize;
+		
+		// Hash of the IR format and frontend versions
+		uint64 formatVersion;
+	};
+	
+	// Method to initialize the parse cache
+	static void initialize();
+	
+	// Method to test if the parse cache is enabled
+	static bool isEnabled() { return s_enableVar.getBoolValue(); }
+	
+	// Method to compute the cache key for a source file
+	static bool getFileKey(const std::string& filePath, FileKey& key);
+	
+	// Method to look up the cached XML IR tree for a source file
+	static XML::Element* lookup(const std::string& filePath, const FileKey& key);
+	
+	// Method to store the XML IR tree for a source file
+	static void store(const std::string& filePath, const FileKey& key, const XML::Element* pTree);
+	
+	// Method to compute a 64-bit hash of a byte buffer
+	static uint64 hashBytes(const char* pData, size_t length);
+	
+	// Config variable to enable/disable the parse cache
+	static ConfigVar s_enableVar;
+	
+	// Config variable for the cache directory
+	static ConfigVar s_dirVar;
+	
+private:
+	
+	// Method to get the cache entry path for a source file
+	static std::string getEntryPath(const std::string& filePath);
+	
+	// Cache entry header signature
+	static const char ENTRY_SIGNATURE[];
+	
+	// Version of the XML IR produced by the code parser's frontend
+	static const char IR_FORMAT_VERSION[];
+	
+	// Hash of the IR format and frontend versions of this run
+	static uint64 s_formatVersion;
+};
+
+#endif // #ifndef PARSECACHE_H_
@@ -20,6 +20,7 @@
 #include <cassert>
 #include <iostream>
 #include "parser.h"
+#include "parsecache.h"
 #include "process.h"
 #include "utility.h"
 #include "stmtsequence.h"
@@ -76,11 +77,43 @@ CompUnits CodeParser::parseSrcFile(const std::string& filePath)
     	return CompUnits();
     }
     	
-	// Have the front-end parse the source code
-	std::string xmlText = Client::parseFile(absPath);
-
-	// Parse the XML IR
-	return parseXMLText(xmlText);
+	// If the parse cache is enabled, compute the cache key for this file
+	// NOTE: computing the key reads and hashes the whole file
+	ParseCache::FileKey fileKey;
+	bool keyValid = ParseCache::isEnabled() && ParseCache::getFileKey(absPath, fileKey);
+	
+	// If the key is valid, look for a cached XML IR tree
+	XML::Element* pCachedTree = keyValid? ParseCache::lookup(absPath, fileKey):NULL;
+	
+	// If a cached tree was found
+	if (pCachedTree != NULL)
+	{
+		// Setup a try block to catch any errors
+		try
+		{
+			// Parse the cached XML tree
+			CompUnits compUnits = parseXMLRoot(pCachedTree);
+			
+			// Delete the cached tree
+			delete pCachedTree;
+			
+			// Return the parsed compilation units
+			return compUnits;
+		}
+		
+		// If XML parsing errors occur
+		catch (XML::ParseError error)
+		{
+			// Delete the cached tree
+			delete pCachedTree;
+			
+			// Log the error and fall back to the front-end
+			std::cout << "WARNING: invalid parse cache entry " + error.toString() << std::endl;
+		}
+	}
+	
+	// Have the front-end parse the source code, and cache the IR if the key is valid
+	return parseXMLText(Client::parseFile(absPath), absPath, keyValid? &fileKey:NULL);
 }
 
 /***************************************************************
@@ -158,7 +191,7 @@ CompUnits CodeParser::parseXMLFile(const std::string& filePath)
 ****************************************************************
 Revisions and bug fixes: Nurudeen A. Lameed on May 5, 2009.
 */
-CompUnits CodeParser::parseXMLText(const std::string& input)
+CompUnits CodeParser::parseXMLText(const std::string& input, const std::string& srcPath, const ParseCache::FileKey* pFileKey)
 {
 	// Create an XML parser object
 	XML::Parser parser;
@@ -183,7 +216,14 @@ CompUnits CodeParser::parseXMLText(const std::string& input)
 		const XML::Element* pTreeRoot = xmlIR.getTree();
 
 		// Parse the XML tree
-		return parseXMLRoot(pTreeRoot);
+		CompUnits compUnits = parseXMLRoot(pTreeRoot);
+		
+		// If a source file key was given, store the parsed tree in the cache
+		if (pFileKey != NULL)
+			ParseCache::store(srcPath, *pFileKey, pTreeRoot);
+		
+		// Return the parsed compilation units
+		return compUnits;
 	}
 
 	// If XML parsing error occur
@@ -30,6 +30,7 @@
 #include "expressions.h"
 #include "stmtsequence.h"
 #include "filesystem.h"
+#include "parsecache.h"
 
 
 // Compilation unit list type definition
@@ -55,8 +56,8 @@ public:
 	// Method to parse an XML file (XML IR)
 	static CompUnits parseXMLFile(const std::string& filePath);
 
-	// Method to parse XML text (XML IR) 
-	static CompUnits parseXMLText(const std::string& input);
+	// Method to parse XML text (XML IR), caching it for a source file if a key is given
+	static CompUnits parseXMLText(const std::string& input, const std::string& srcPath = "", const ParseCache::FileKey* pFileKey = NULL);
 	
 private:
 
@@ -22,20 +22,127 @@
 
 // Header files
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <typeinfo>
 #include <vector>
+#include <gc.h>
 #include "platform.h"
 using std::ptrdiff_t;
-typedef std::vector<byte*> PointerVector;
 
+/***************************************************************
+* Struct  : PoolStats
+* Purpose : Usage statistics of one pool allocator type
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+struct PoolStats
+{
+	// Name of the pooled type
+	const char* typeName;
+	
+	// Size of one unit, in bytes
+	size_t unitSize;
+	
+	// Number of chunks currently held, and the peak number held
+	size_t numChunks;
+	size_t peakChunks;
+	
+	// Number of empty chunks given back to the system
+	size_t chunksReleased;
+	
+	// Number of units handed out of the global depot
+	size_t unitsOut;
+	
+	// Number of batch transfers between thread caches and the depot
+	uint64 depotRefills;
+	uint64 depotReturns;
+};
+
+/***************************************************************
+* Class   : PoolRegistry
+* Purpose : List of the pool allocator types in use
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class PoolRegistry
+{
+public:
+	
+	// Statistics query function type
+	typedef PoolStats (*StatsFunc)();
+	
+	// Method to register a pool allocator type
+	static void registerPool(StatsFunc pStatsFunc)
+	{
+		// Add the pool to the list
+		std::lock_guard<std::mutex> lock(getMutex());
+		getPools().push_back(pStatsFunc);
+	}
+	
+	// Method to print the statistics of all pools
+	static void printStats(std::ostream& out)
+	{
+		// Copy the pool list so that the pools can be queried unlocked
+		std::vector<StatsFunc> pools;
+		{
+			std::lock_guard<std::mutex> lock(getMutex());
+			pools = getPools();
+		}
+		
+		// For each registered pool
+		for (size_t i = 0; i < pools.size(); ++i)
+		{
+			// Get the statistics of this pool
+			PoolStats stats = pools[i]();
+			
+			// Print the statistics
+			out << "pool " << stats.typeName << " (" << stats.unitSize << " B units): ";
+			out << stats.unitsOut << " units out, " << stats.numChunks << " chunks (peak " << stats.peakChunks << "), ";
+			out << stats.chunksReleased << " released, " << stats.depotRefills << " refills, ";
+			out << stats.depotReturns << " returns" << std::endl;
+		}
+	}
+	
+private:
+	
+	// Accessors to the pool list and its lock
+	static std::vector<StatsFunc>& getPools() { static std::vector<StatsFunc> pools; return pools; }
+	static std::mutex& getMutex() { static std::mutex mutex; return mutex; }
+};
+
+/***************************************************************
+* Class   : PoolAlloc<>
+* Purpose : Thread-safe pool allocator for single objects
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+
+Each thread keeps a small cache of free units. Caches are refilled
+from, and overflow back into, a global depot in batches, so the depot
+lock is taken once per batch. The depot carves units out of chunks and
+gives fully empty chunks back to the system past a watermark. Chunks
+are registered as GC roots, since pooled objects may point to
+garbage-collected data.
+*/
 template <class T> class PoolAlloc
 {
 public:
 
-	// Memory chunk size constant
-	static const size_t CHUNK_SIZE = 50000;
+	// Memory chunk size constant, in bytes
+	static const size_t CHUNK_BYTES = 256 * 1024;
+	
+	// Number of units moved between a thread cache and the depot at once
+	static const size_t BATCH_SIZE = 64;
+	
+	// Number of empty chunks the depot keeps before releasing them
+	static const size_t MAX_EMPTY_CHUNKS = 2;
 	
 	// Type definitions
 	typedef size_t    size_type;
@@ -65,40 +172,31 @@ public:
 		// Ensure that the count is 1
 		assert (cnt == 1);
 		
-		// If no free units are available
-		if (m_freeUnits.empty())
-		{
-			// std::cout << "Expanding pool" << std::endl;
-
-			// Allocate a new memory chunk
-			byte* pNewChunk = new byte[sizeof(value_type) * CHUNK_SIZE];
-			
-			// Add the new chunk to the list
-			m_chunks.push_back(pNewChunk);
-			
-			// Reserve room in the free unit vector
-			m_freeUnits.reserve(m_freeUnits.capacity() + CHUNK_SIZE);
-			
-			// Add all free units to the free list
-			const byte* pEnd = pNewChunk + sizeof(value_type) * CHUNK_SIZE;
-			for (byte* pUnitPtr = pNewChunk; pUnitPtr != pEnd; pUnitPtr += sizeof(value_type))
-				m_freeUnits.push_back(pUnitPtr);
-		}
+		// If the thread cache is empty, refill it from the depot
+		if (s_cache.pFreeList == NULL)
+			getDepot().refill(s_cache);
 		
-		// Get the last unit from the free list and remove it
-		pointer pUnitPtr = (pointer)m_freeUnits.back();
-		m_freeUnits.pop_back();
+		// Get the first unit from the thread cache and remove it
+		void* pUnit = s_cache.pFreeList;
+		s_cache.pFreeList = nextUnit(pUnit);
+		--s_cache.numFree;
 		
 		// Return the unit
-		return pUnitPtr;
+		return (pointer)pUnit;
 	}
 	
 	// Method to deallocate memory
 	void deallocate(pointer p, size_type n)
 	{ 
-		// Add the unit back to the free list
-		m_freeUnits.push_back((byte*)p);
-    }
+		// Add the unit back to the thread cache
+		nextUnit(p) = s_cache.pFreeList;
+		s_cache.pFreeList = p;
+		++s_cache.numFree;
+		
+		// If the thread cache holds too many units, give a batch back
+		if (s_cache.numFree > 2 * BATCH_SIZE)
+			getDepot().drain(s_cache, BATCH_SIZE);
+	}
 
 	// Method to get the maximum allocatable size
 	size_type max_size() const
@@ -116,19 +214,282 @@ public:
 	inline bool operator == (PoolAlloc const&) { return true; }
 	inline bool operator != (PoolAlloc const& a) { return !operator==(a); }
 	
+	// Method to get the statistics of this pool
+	static PoolStats getStats() { return getDepot().getStats(); }
+	
 private:
-
-	// Memory chunk list
-	static PointerVector m_chunks;
 	
-	// Free unit list	
-	static PointerVector m_freeUnits;
+	// Unit size, large enough to hold a free list link
+	static const size_t UNIT_SIZE = (sizeof(T) < sizeof(void*))? sizeof(void*):sizeof(T);
+	
+	// Number of units per chunk
+	static const size_t CHUNK_UNITS = (CHUNK_BYTES / UNIT_SIZE < 16)? 16:(CHUNK_BYTES / UNIT_SIZE);
+	
+	// Accessor to the free list link stored in a free unit
+	static void*& nextUnit(void* pUnit) { return *(void**)pUnit; }
+	
+	/***************************************************************
+	* Struct  : ThreadCache
+	* Purpose : Per-thread list of free units
+	****************************************************************/
+	struct ThreadCache
+	{
+		ThreadCache() : pFreeList(NULL), numFree(0) {}
+		
+		// Give the cached units back to the depot when the thread exits
+		~ThreadCache() { if (numFree != 0) getDepot().drain(*this, numFree); }
+		
+		// Free unit list and its length
+		void* pFreeList;
+		size_t numFree;
+	};
+	
+	/***************************************************************
+	* Struct  : Chunk
+	* Purpose : Memory chunk units are carved from
+	****************************************************************/
+	struct Chunk
+	{
+		// Chunk memory
+		byte* pMem;
+		
+		// Number of units never handed out, at the end of the chunk
+		size_t numUncarved;
+		
+		// List of units given back to the chunk, and the free unit count
+		void* pFreeList;
+		size_t numFree;
+		
+		// Links in the list of chunks with free units
+		Chunk* pPrev;
+		Chunk* pNext;
+	};
+	
+	/***************************************************************
+	* Class   : Depot
+	* Purpose : Global store of chunks shared by all threads
+	****************************************************************/
+	class Depot
+	{
+	public:
+		
+		// Map of chunks indexed by address
+		typedef std::map<byte*, Chunk*> ChunkMap;
+		
+		Depot() : m_pAvail(NULL), m_numEmpty(0)
+		{
+			// Clear the statistics
+			m_stats.typeName = typeid(T).name();
+			m_stats.unitSize = UNIT_SIZE;
+			m_stats.numChunks = 0;
+			m_stats.peakChunks = 0;
+			m_stats.chunksReleased = 0;
+			m_stats.unitsOut = 0;
+			m_stats.depotRefills = 0;
+			m_stats.depotReturns = 0;
+			
+			// Make the statistics of this pool visible
+			PoolRegistry::registerPool(&PoolAlloc::getStats);
+		}
+		
+		// Method to move a batch of free units into a thread cache
+		void refill(ThreadCache& cache)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			
+			// For each unit of the batch
+			for (size_t i = 0; i < BATCH_SIZE; ++i)
+			{
+				// If no chunk has free units, allocate a new one
+				if (m_pAvail == NULL)
+					newChunk();
+				
+				// Take a unit from the first chunk with free units
+				void* pUnit = takeUnit(m_pAvail);
+				
+				// Add the unit to the thread cache
+				nextUnit(pUnit) = cache.pFreeList;
+				cache.pFreeList = pUnit;
+				++cache.numFree;
+			}
+			
+			// Update the statistics
+			m_stats.unitsOut += BATCH_SIZE;
+			++m_stats.depotRefills;
+		}
+		
+		// Method to move free units from a thread cache back to the depot
+		void drain(ThreadCache& cache, size_t count)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			
+			// For each unit to give back
+			for (size_t i = 0; i < count; ++i)
+			{
+				// Remove the unit from the thread cache
+				void* pUnit = cache.pFreeList;
+				cache.pFreeList = nextUnit(pUnit);
+				--cache.numFree;
+				
+				// Give the unit back to its chunk
+				giveUnit(pUnit);
+			}
+			
+			// Update the statistics
+			m_stats.unitsOut -= count;
+			++m_stats.depotReturns;
+		}
+		
+		// Method to get the statistics of this depot
+		PoolStats getStats()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_stats;
+		}
+		
+	private:
+		
+		// Method to allocate a new chunk
+		void newChunk()
+		{
+			// Allocate the chunk memory and let the GC scan it
+			Chunk* pChunk = new Chunk();
+			pChunk->pMem = (byte*)malloc(CHUNK_UNITS * UNIT_SIZE);
+			if (pChunk->pMem == NULL)
+				throw std::bad_alloc();
+			GC_add_roots(pChunk->pMem, pChunk->pMem + CHUNK_UNITS * UNIT_SIZE);
+			
+			// All units are yet to be carved
+			pChunk->numUncarved = CHUNK_UNITS;
+			pChunk->pFreeList = NULL;
+			pChunk->numFree = CHUNK_UNITS;
+			
+			// Index the chunk by address and make it available
+			m_chunks[pChunk->pMem] = pChunk;
+			linkAvail(pChunk);
+			++m_numEmpty;
+			
+			// Update the statistics
+			++m_stats.numChunks;
+			m_stats.peakChunks = std::max(m_stats.peakChunks, m_stats.numChunks);
+		}
+		
+		// Method to take a free unit from a chunk
+		void* takeUnit(Chunk* pChunk)
+		{
+			// If the chunk was empty, it no longer is
+			if (pChunk->numFree == CHUNK_UNITS)
+				--m_numEmpty;
+			
+			// Take a unit from the free list, or carve a new one
+			void* pUnit;
+			if (pChunk->pFreeList != NULL)
+			{
+				pUnit = pChunk->pFreeList;
+				pChunk->pFreeList = nextUnit(pUnit);
+			}
+			else
+			{
+				pUnit = pChunk->pMem + (CHUNK_UNITS - pChunk->numUncarved) * UNIT_SIZE;
+				--pChunk->numUncarved;
+			}
+			
+			// If the chunk is now full, it is no longer available
+			if (--pChunk->numFree == 0)
+				unlinkAvail(pChunk);
+			
+			// Return the unit
+			return pUnit;
+		}
+		
+		// Method to give a unit back to its chunk
+		void giveUnit(void* pUnit)
+		{
+			// Find the chunk the unit belongs to
+			typename ChunkMap::iterator itr = m_chunks.upper_bound((byte*)pUnit);
+			assert (itr != m_chunks.begin());
+			Chunk* pChunk = (--itr)->second;
+			
+			// If the chunk was full, make it available again
+			if (pChunk->numFree == 0)
+				linkAvail(pChunk);
+			
+			// Add the unit to the chunk's free list
+			nextUnit(pUnit) = pChunk->pFreeList;
+			pChunk->pFreeList = pUnit;
+			
+			// If the chunk is not empty yet, stop
+			if (++pChunk->numFree != CHUNK_UNITS)
+				return;
+			
+			// Reset the empty chunk so units are carved in order again
+			pChunk->pFreeList = NULL;
+			pChunk->numUncarved = CHUNK_UNITS;
+			++m_numEmpty;
+			
+			// If there are too many empty chunks, release this one
+			if (m_numEmpty > MAX_EMPTY_CHUNKS)
+				releaseChunk(itr, pChunk);
+		}
+		
+		// Method to give an empty chunk back to the system
+		void releaseChunk(typename ChunkMap::iterator itr, Chunk* pChunk)
+		{
+			// Remove the chunk from the depot
+			unlinkAvail(pChunk);
+			m_chunks.erase(itr);
+			--m_numEmpty;
+			
+			// Free the chunk memory
+			GC_remove_roots(pChunk->pMem, pChunk->pMem + CHUNK_UNITS * UNIT_SIZE);
+			free(pChunk->pMem);
+			delete pChunk;
+			
+			// Update the statistics
+			--m_stats.numChunks;
+			++m_stats.chunksReleased;
+		}
+		
+		// Methods to link and unlink a chunk from the available list
+		void linkAvail(Chunk* pChunk)
+		{
+			pChunk->pPrev = NULL;
+			pChunk->pNext = m_pAvail;
+			if (m_pAvail) m_pAvail->pPrev = pChunk;
+			m_pAvail = pChunk;
+		}
+		void unlinkAvail(Chunk* pChunk)
+		{
+			if (pChunk->pPrev) pChunk->pPrev->pNext = pChunk->pNext;
+			else m_pAvail = pChunk->pNext;
+			if (pChunk->pNext) pChunk->pNext->pPrev = pChunk->pPrev;
+		}
+		
+		// Chunks indexed by address
+		ChunkMap m_chunks;
+		
+		// List of chunks with free units
+		Chunk* m_pAvail;
+		
+		// Number of chunks with no units handed out
+		size_t m_numEmpty;
+		
+		// Pool statistics
+		PoolStats m_stats;
+		
+		// Lock protecting the depot
+		std::mutex m_mutex;
+	};
+	
+	// Accessor to the global depot, which is never destroyed so that
+	// thread caches can still drain into it at exit
+	static Depot& getDepot() { static Depot* pDepot = new Depot(); return *pDepot; }
+	
+	// Free unit cache of the current thread
+	static thread_local ThreadCache s_cache;
 };
 
-// Memory chunk list
-template <class T> PointerVector PoolAlloc<T>::m_chunks;
-	
-// Free unit list
-template <class T> PointerVector PoolAlloc<T>::m_freeUnits;
+// Free unit cache of the current thread
+template <class T> thread_local typename PoolAlloc<T>::ThreadCache PoolAlloc<T>::s_cache;
 
 #endif // #ifndef POOLALLOC_H_
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <sys/time.h>
 #include "profiling.h"
+#include "poolalloc.h"
 #include "interpreter.h"
 #include "cellarrayobj.h"
 #include "chararrayobj.h"
@@ -47,14 +48,30 @@ const std::string Profiler::COUNTER_VAR_NAMES[NUM_COUNTERS] =
 	"num scalars known",
 	"num matrices found",
 	"num mat. size known",
-	"array copy count"
+	"array copy count",
+	"parse cache hits",
+	"parse cache misses",
+	"call cache hits",
+	"call cache misses",
+	"dim vector allocs",
+	"slab object allocs",
+	"slab refills",
+	"matrix buffer allocs",
+	"matrix buffer bytes",
+	"gc collections",
+	"dead vars released",
+	"dead buffers freed",
+	"code cache hits",
+	"code cache misses"
 };
 
 // Timer variable names
 const std::string Profiler::TIMER_VAR_NAMES[NUM_TIMERS] =
 {
 	"total comp. time",
-	"total analysis time"
+	"total analysis time",
+	"total gc pause time",
+	"max gc pause"
 };
 
 // Library function to reset the profiling context
@@ -100,6 +117,22 @@ void Profiler::incrCounter(CounterVar counterVar)
 	s_curContext.counters[counterVar] += 1;
 }
 
+/***************************************************************
+* Function: Profiler::addCounter()
+* Purpose : Add a value to a counter variable
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Profiler::addCounter(CounterVar counterVar, uint64 value)
+{
+	// Ensure that the counter variable is valid
+	assert (counterVar < NUM_COUNTERS);
+	
+	// Add the value to the desired counter
+	s_curContext.counters[counterVar] += value;
+}
+
 /***************************************************************
 * Function: Profiler::getCounter()
 * Purpose : Get the value of a counter variable
@@ -187,6 +220,23 @@ void Profiler::stopTimer(TimerVar timerVar)
 	s_curContext.timerRuns[timerVar] -= 1;
 }
 
+/***************************************************************
+* Function: Profiler::recordGCPause()
+* Purpose : Record the duration of a garbage collection pause
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Profiler::recordGCPause(float64 pauseSecs)
+{
+	// Add the pause to the total pause time
+	s_curContext.timers[GC_PAUSE_TOTAL] += pauseSecs;
+	
+	// Keep track of the longest pause
+	if (pauseSecs > s_curContext.timers[GC_PAUSE_MAX])
+		s_curContext.timers[GC_PAUSE_MAX] = pauseSecs;
+}
+
 /***************************************************************
 * Function: Profiler::getTimeSeconds()
 * Purpose : Get the current time in seconds
@@ -317,6 +367,9 @@ ArrayObj* Profiler::printInfoCmd(ArrayObj* pArguments)
 		std::cout << TIMER_VAR_NAMES[i] << ": " << s_curContext.timers[i] << " s" << std::endl;
 	}
 	
+	// Print the statistics of the pool allocators in use
+	PoolRegistry::printStats(std::cout);
+	
 	// Return no output
 	return new ArrayObj();
 }
@@ -32,12 +32,14 @@
 // Profiler macro definitions
 #ifndef MCVM_DISABLE_PROFILING
 	#define PROF_INCR_COUNTER(COUNTER_VAR) (Profiler::incrCounter(COUNTER_VAR))
+	#define PROF_ADD_COUNTER(COUNTER_VAR, VALUE) (Profiler::addCounter(COUNTER_VAR, VALUE))
 	#define PROF_GET_COUNTER(COUNTER_VAR) (Profiler::getCounter(COUNTER_VAR))
 	#define PROF_SET_COUNTER(COUNTER_VAR, VALUE) (Profiler::setCounter(COUNTER_VAR, VALUE))
 	#define PROF_START_TIMER(TIMER_VAR) (Profiler::startTimer(TIMER_VAR))
 	#define PROF_STOP_TIMER(TIMER_VAR) (Profiler::stopTimer(TIMER_VAR))
 #else
 	#define PROF_INCR_COUNTER()
+	#define PROF_ADD_COUNTER()
 	#define PROF_GET_COUNTER()
 	#define PROF_SET_COUNTER()
 	#define PROF_START_TIMER()
@@ -77,6 +79,20 @@ public:
 		TYPE_NUM_MATRICES,
 		TYPE_NUM_KNOWN_SIZE,
 		ARRAY_COPY_COUNT,
+		PARSE_CACHE_HIT_COUNT,
+		PARSE_CACHE_MISS_COUNT,
+		CALL_CACHE_HIT_COUNT,
+		CALL_CACHE_MISS_COUNT,
+		DIMVECTOR_ALLOC_COUNT,
+		SLAB_ALLOC_COUNT,
+		SLAB_REFILL_COUNT,
+		MATRIX_BUF_ALLOC_COUNT,
+		MATRIX_BUF_ALLOC_BYTES,
+		GC_COLLECTION_COUNT,
+		DEAD_VAR_RELEASE_COUNT,
+		DEAD_BUFFER_FREE_COUNT,
+		CODE_CACHE_HIT_COUNT,
+		CODE_CACHE_MISS_COUNT,
 		NUM_COUNTERS
 	};
 
@@ -85,6 +101,8 @@ public:
 	{
 		COMP_TIME_TOTAL,
 		ANA_TIME_TOTAL,
+		GC_PAUSE_TOTAL,
+		GC_PAUSE_MAX,
 		NUM_TIMERS
 	};
 	
@@ -100,6 +118,9 @@ public:
 	// Method to increment a counter variable
 	static void incrCounter(CounterVar counterVar);
 	
+	// Method to add a value to a counter variable
+	static void addCounter(CounterVar counterVar, uint64 value);
+	
 	// Methods to get and set a counter variable
 	static uint64 getCounter(CounterVar counterVar);
 	static void setCounter(CounterVar counterVar, uint64 value);
@@ -108,6 +129,9 @@ public:
 	static void startTimer(TimerVar timerVar);
 	static void stopTimer(TimerVar timerVar);
 	
+	// Method to record the duration of a garbage collection pause
+	static void recordGCPause(float64 pauseSecs);
+	
 	// Method to get the current time in seconds
 	static double getTimeSeconds();
 	
@@ -69,39 +69,6 @@ private:
 	ErrorStack m_errorStack;
 };
 
-/***************************************************************
-* Class   : ReturnExcept
-* Purpose : Exception class used to implement return statements
-* Initial : Maxime Chevalier-Boisvert on February 26, 2009
-****************************************************************
-Revisions and bug fixes:
-*/
-class ReturnExcept
-{
-};
-
-/***************************************************************
-* Class   : BreakExcept
-* Purpose : Exception class used to implement break statements
-* Initial : Maxime Chevalier-Boisvert on February 26, 2009
-****************************************************************
-Revisions and bug fixes:
-*/
-class BreakExcept
-{
-};
-
-/***************************************************************
-* Class   : ContinueExcept
-* Purpose : Exception class used for continue statements
-* Initial : Maxime Chevalier-Boisvert on February 26, 2009
-****************************************************************
-Revisions and bug fixes:
-*/
-class ContinueExcept
-{
-};
-
 // Function to evaluate the boolean value of an object
 bool getBoolValue(const DataObject* pObject);
 
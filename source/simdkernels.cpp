@@ -0,0 +1,699 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cmath>
+#include <cstdlib>
+#include "simdkernels.h"
+
+// Vectorized kernels are only provided for x86-64 processors
+#if defined(__x86_64__)
+#define SIMD_X86_64
+#include <immintrin.h>
+#endif
+
+// Config variable to enable/disable the vectorized kernels
+ConfigVar SimdKernels::s_simdEnableVar("simd_enable", ConfigVar::BOOL, "true");
+
+// Config variable for the highest instruction set level to use
+ConfigVar SimdKernels::s_simdMaxLevelVar("simd_max_level", ConfigVar::INT, "2", 0, 2);
+
+// Highest instruction set level supported by the CPU
+SimdKernels::Level SimdKernels::s_cpuLevel = SimdKernels::LEVEL_NONE;
+
+/***************************************************************
+* Function: applyScalar()
+* Purpose : Apply a binary operation to scalar values
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP, class T> static inline T applyScalar(T a, T b)
+{
+	// Switch on the operation
+	switch (OP)
+	{
+		case SimdKernels::OP_ADD:	return a + b;
+		case SimdKernels::OP_SUB:	return a - b;
+		case SimdKernels::OP_MULT:	return a * b;
+		case SimdKernels::OP_DIV:	return a / b;
+	}
+	
+	// Unreachable
+	return a;
+}
+
+/***************************************************************
+* Function: applyScalar()
+* Purpose : Apply a binary operation to logical values
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static inline bool applyScalar(bool a, bool b)
+{
+	// Perform the logical AND or OR
+	return (OP == SimdKernels::OP_AND)? (a && b):(a || b);
+}
+
+/***************************************************************
+* Function: binaryTail()
+* Purpose : Apply a binary operation to the remaining elements
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP, class T> static inline void binaryTail(const T* pA, size_t strideA, const T* pB, size_t strideB, T* pOut, size_t i, size_t n)
+{
+	// Process the elements one at a time
+	for (; i < n; ++i)
+		pOut[i] = applyScalar<OP>(pA[i * strideA], pB[i * strideB]);
+}
+
+#ifdef SIMD_X86_64
+
+/***************************************************************
+* Function: applySse2()
+* Purpose : Apply a binary operation to SSE2 registers
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static inline __m128d applySse2(__m128d a, __m128d b)
+{
+	// Switch on the operation
+	switch (OP)
+	{
+		case SimdKernels::OP_ADD:	return _mm_add_pd(a, b);
+		case SimdKernels::OP_SUB:	return _mm_sub_pd(a, b);
+		case SimdKernels::OP_MULT:	return _mm_mul_pd(a, b);
+		case SimdKernels::OP_DIV:	return _mm_div_pd(a, b);
+	}
+	
+	// Unreachable
+	return a;
+}
+
+template <int OP> static inline __m128 applySse2(__m128 a, __m128 b)
+{
+	// Switch on the operation
+	switch (OP)
+	{
+		case SimdKernels::OP_ADD:	return _mm_add_ps(a, b);
+		case SimdKernels::OP_SUB:	return _mm_sub_ps(a, b);
+		case SimdKernels::OP_MULT:	return _mm_mul_ps(a, b);
+		case SimdKernels::OP_DIV:	return _mm_div_ps(a, b);
+	}
+	
+	// Unreachable
+	return a;
+}
+
+template <int OP> static inline __m128i applySse2(__m128i a, __m128i b)
+{
+	// Logical values are stored as 0 or 1 bytes
+	return (OP == SimdKernels::OP_AND)? _mm_and_si128(a, b):_mm_or_si128(a, b);
+}
+
+/***************************************************************
+* Function: applyAvx2()
+* Purpose : Apply a binary operation to AVX2 registers
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> __attribute__((target("avx2"))) static inline __m256d applyAvx2(__m256d a, __m256d b)
+{
+	// Switch on the operation
+	switch (OP)
+	{
+		case SimdKernels::OP_ADD:	return _mm256_add_pd(a, b);
+		case SimdKernels::OP_SUB:	return _mm256_sub_pd(a, b);
+		case SimdKernels::OP_MULT:	return _mm256_mul_pd(a, b);
+		case SimdKernels::OP_DIV:	return _mm256_div_pd(a, b);
+	}
+	
+	// Unreachable
+	return a;
+}
+
+template <int OP> __attribute__((target("avx2"))) static inline __m256 applyAvx2(__m256 a, __m256 b)
+{
+	// Switch on the operation
+	switch (OP)
+	{
+		case SimdKernels::OP_ADD:	return _mm256_add_ps(a, b);
+		case SimdKernels::OP_SUB:	return _mm256_sub_ps(a, b);
+		case SimdKernels::OP_MULT:	return _mm256_mul_ps(a, b);
+		case SimdKernels::OP_DIV:	return _mm256_div_ps(a, b);
+	}
+	
+	// Unreachable
+	return a;
+}
+
+template <int OP> __attribute__((target("avx2"))) static inline __m256i applyAvx2(__m256i a, __m256i b)
+{
+	// Logical values are stored as 0 or 1 bytes
+	return (OP == SimdKernels::OP_AND)? _mm256_and_si256(a, b):_mm256_or_si256(a, b);
+}
+
+/***************************************************************
+* Function: binaryF64Sse2()
+* Purpose : SSE2 kernel for float64 binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static void binaryF64Sse2(const float64* pA, size_t strideA, const float64* pB, size_t strideB, float64* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m128d scalarA = strideA? _mm_setzero_pd():_mm_set1_pd(*pA);
+	__m128d scalarB = strideB? _mm_setzero_pd():_mm_set1_pd(*pB);
+	
+	// Process two elements at a time
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2)
+	{
+		__m128d a = strideA? _mm_loadu_pd(pA + i):scalarA;
+		__m128d b = strideB? _mm_loadu_pd(pB + i):scalarB;
+		_mm_storeu_pd(pOut + i, applySse2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: binaryF64Avx2()
+* Purpose : AVX2 kernel for float64 binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> __attribute__((target("avx2"))) static void binaryF64Avx2(const float64* pA, size_t strideA, const float64* pB, size_t strideB, float64* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m256d scalarA = strideA? _mm256_setzero_pd():_mm256_set1_pd(*pA);
+	__m256d scalarB = strideB? _mm256_setzero_pd():_mm256_set1_pd(*pB);
+	
+	// Process four elements at a time
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		__m256d a = strideA? _mm256_loadu_pd(pA + i):scalarA;
+		__m256d b = strideB? _mm256_loadu_pd(pB + i):scalarB;
+		_mm256_storeu_pd(pOut + i, applyAvx2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: binaryF32Sse2()
+* Purpose : SSE2 kernel for float32 binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static void binaryF32Sse2(const float32* pA, size_t strideA, const float32* pB, size_t strideB, float32* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m128 scalarA = strideA? _mm_setzero_ps():_mm_set1_ps(*pA);
+	__m128 scalarB = strideB? _mm_setzero_ps():_mm_set1_ps(*pB);
+	
+	// Process four elements at a time
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128 a = strideA? _mm_loadu_ps(pA + i):scalarA;
+		__m128 b = strideB? _mm_loadu_ps(pB + i):scalarB;
+		_mm_storeu_ps(pOut + i, applySse2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: binaryF32Avx2()
+* Purpose : AVX2 kernel for float32 binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> __attribute__((target("avx2"))) static void binaryF32Avx2(const float32* pA, size_t strideA, const float32* pB, size_t strideB, float32* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m256 scalarA = strideA? _mm256_setzero_ps():_mm256_set1_ps(*pA);
+	__m256 scalarB = strideB? _mm256_setzero_ps():_mm256_set1_ps(*pB);
+	
+	// Process eight elements at a time
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256 a = strideA? _mm256_loadu_ps(pA + i):scalarA;
+		__m256 b = strideB? _mm256_loadu_ps(pB + i):scalarB;
+		_mm256_storeu_ps(pOut + i, applyAvx2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: binaryC128Sse2()
+* Purpose : SSE2 kernel for complex binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static void binaryC128Sse2(const Complex128* pA, size_t strideA, const Complex128* pB, size_t strideB, Complex128* pOut, size_t n)
+{
+	// Get pointers to the real and imaginary parts
+	const float64* pAVals = reinterpret_cast<const float64*>(pA);
+	const float64* pBVals = reinterpret_cast<const float64*>(pB);
+	float64* pOutVals = reinterpret_cast<float64*>(pOut);
+	
+	// Process one complex element, stored in one register, at a time
+	for (size_t i = 0; i < n; ++i)
+	{
+		__m128d a = _mm_loadu_pd(pAVals + 2 * i * strideA);
+		__m128d b = _mm_loadu_pd(pBVals + 2 * i * strideB);
+		_mm_storeu_pd(pOutVals + 2 * i, applySse2<OP>(a, b));
+	}
+}
+
+/***************************************************************
+* Function: binaryBoolSse2()
+* Purpose : SSE2 kernel for logical binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static void binaryBoolSse2(const bool* pA, size_t strideA, const bool* pB, size_t strideB, bool* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m128i scalarA = strideA? _mm_setzero_si128():_mm_set1_epi8(*pA);
+	__m128i scalarB = strideB? _mm_setzero_si128():_mm_set1_epi8(*pB);
+	
+	// Process sixteen elements at a time
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16)
+	{
+		__m128i a = strideA? _mm_loadu_si128((const __m128i*)(pA + i)):scalarA;
+		__m128i b = strideB? _mm_loadu_si128((const __m128i*)(pB + i)):scalarB;
+		_mm_storeu_si128((__m128i*)(pOut + i), applySse2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: binaryBoolAvx2()
+* Purpose : AVX2 kernel for logical binary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> __attribute__((target("avx2"))) static void binaryBoolAvx2(const bool* pA, size_t strideA, const bool* pB, size_t strideB, bool* pOut, size_t n)
+{
+	// Broadcast the scalar operands, array operands are loaded in the loop
+	__m256i scalarA = strideA? _mm256_setzero_si256():_mm256_set1_epi8(*pA);
+	__m256i scalarB = strideB? _mm256_setzero_si256():_mm256_set1_epi8(*pB);
+	
+	// Process thirty-two elements at a time
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32)
+	{
+		__m256i a = strideA? _mm256_loadu_si256((const __m256i*)(pA + i)):scalarA;
+		__m256i b = strideB? _mm256_loadu_si256((const __m256i*)(pB + i)):scalarB;
+		_mm256_storeu_si256((__m256i*)(pOut + i), applyAvx2<OP>(a, b));
+	}
+	
+	// Process the remaining elements
+	binaryTail<OP>(pA, strideA, pB, strideB, pOut, i, n);
+}
+
+/***************************************************************
+* Function: unaryF64Sse2()
+* Purpose : SSE2 kernel for float64 unary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> static void unaryF64Sse2(const float64* pIn, float64* pOut, size_t n)
+{
+	// Mask clearing the sign bit
+	__m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+	
+	// Process two elements at a time
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2)
+	{
+		__m128d a = _mm_loadu_pd(pIn + i);
+		_mm_storeu_pd(pOut + i, (OP == SimdKernels::OP_SQRT)? _mm_sqrt_pd(a):_mm_and_pd(a, absMask));
+	}
+	
+	// Process the remaining elements
+	for (; i < n; ++i)
+		pOut[i] = (OP == SimdKernels::OP_SQRT)? std::sqrt(pIn[i]):std::fabs(pIn[i]);
+}
+
+/***************************************************************
+* Function: unaryF64Avx2()
+* Purpose : AVX2 kernel for float64 unary operations
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <int OP> __attribute__((target("avx2"))) static void unaryF64Avx2(const float64* pIn, float64* pOut, size_t n)
+{
+	// Mask clearing the sign bit
+	__m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+	
+	// Process four elements at a time
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		__m256d a = _mm256_loadu_pd(pIn + i);
+		_mm256_storeu_pd(pOut + i, (OP == SimdKernels::OP_SQRT)? _mm256_sqrt_pd(a):_mm256_and_pd(a, absMask));
+	}
+	
+	// Process the remaining elements
+	for (; i < n; ++i)
+		pOut[i] = (OP == SimdKernels::OP_SQRT)? std::sqrt(pIn[i]):std::fabs(pIn[i]);
+}
+
+#endif // #ifdef SIMD_X86_64
+
+/***************************************************************
+* Function: SimdKernels::initialize()
+* Purpose : Initialize the kernels and detect the CPU features
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void SimdKernels::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_simdEnableVar);
+	ConfigManager::registerVar(&s_simdMaxLevelVar);
+	
+#ifdef SIMD_X86_64
+	// SSE2 is part of the x86-64 base instruction set
+	s_cpuLevel = LEVEL_SSE2;
+	
+	// Detect AVX2 support
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		s_cpuLevel = LEVEL_AVX2;
+#endif
+}
+
+/***************************************************************
+* Function: SimdKernels::getLevel()
+* Purpose : Get the instruction set level currently in use
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+SimdKernels::Level SimdKernels::getLevel()
+{
+	// If the kernels are disabled, use no vector instructions
+	if (s_simdEnableVar.getBoolValue() == false)
+		return LEVEL_NONE;
+	
+	// Use the highest level supported by the CPU, up to the configured maximum
+	long int maxLevel = s_simdMaxLevelVar.getIntValue();
+	return (maxLevel < s_cpuLevel)? (Level)maxLevel:s_cpuLevel;
+}
+
+/***************************************************************
+* Function: SimdKernels::getLevelName()
+* Purpose : Get the name of an instruction set level
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const char* SimdKernels::getLevelName(Level level)
+{
+	// Switch on the level
+	switch (level)
+	{
+		case LEVEL_SSE2: return "sse2";
+		case LEVEL_AVX2: return "avx2";
+		default: return "none";
+	}
+}
+
+/***************************************************************
+* Function: SimdKernels::binaryF64()
+* Purpose : Apply a binary operation to float64 arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SimdKernels::binaryF64(BinOp op, const float64* pA, bool scalarA, const float64* pB, bool scalarB, float64* pOut, size_t n)
+{
+#ifdef SIMD_X86_64
+	// Get the operand strides, scalars are broadcast
+	size_t strideA = scalarA? 0:1;
+	size_t strideB = scalarB? 0:1;
+	
+	// Switch on the instruction set level
+	switch (getLevel())
+	{
+		case LEVEL_AVX2:
+		{
+			switch (op)
+			{
+				case OP_ADD:	binaryF64Avx2<OP_ADD>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_SUB:	binaryF64Avx2<OP_SUB>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_MULT:	binaryF64Avx2<OP_MULT>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_DIV:	binaryF64Avx2<OP_DIV>(pA, strideA, pB, strideB, pOut, n); return true;
+				default: break;
+			}
+		}
+		break;
+		
+		case LEVEL_SSE2:
+		{
+			switch (op)
+			{
+				case OP_ADD:	binaryF64Sse2<OP_ADD>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_SUB:	binaryF64Sse2<OP_SUB>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_MULT:	binaryF64Sse2<OP_MULT>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_DIV:	binaryF64Sse2<OP_DIV>(pA, strideA, pB, strideB, pOut, n); return true;
+				default: break;
+			}
+		}
+		break;
+		
+		default: break;
+	}
+#endif
+	
+	// No kernel applies
+	return false;
+}
+
+/***************************************************************
+* Function: SimdKernels::binaryF32()
+* Purpose : Apply a binary operation to float32 arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SimdKernels::binaryF32(BinOp op, const float32* pA, bool scalarA, const float32* pB, bool scalarB, float32* pOut, size_t n)
+{
+#ifdef SIMD_X86_64
+	// Get the operand strides, scalars are broadcast
+	size_t strideA = scalarA? 0:1;
+	size_t strideB = scalarB? 0:1;
+	
+	// Switch on the instruction set level
+	switch (getLevel())
+	{
+		case LEVEL_AVX2:
+		{
+			switch (op)
+			{
+				case OP_ADD:	binaryF32Avx2<OP_ADD>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_SUB:	binaryF32Avx2<OP_SUB>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_MULT:	binaryF32Avx2<OP_MULT>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_DIV:	binaryF32Avx2<OP_DIV>(pA, strideA, pB, strideB, pOut, n); return true;
+				default: break;
+			}
+		}
+		break;
+		
+		case LEVEL_SSE2:
+		{
+			switch (op)
+			{
+				case OP_ADD:	binaryF32Sse2<OP_ADD>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_SUB:	binaryF32Sse2<OP_SUB>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_MULT:	binaryF32Sse2<OP_MULT>(pA, strideA, pB, strideB, pOut, n); return true;
+				case OP_DIV:	binaryF32Sse2<OP_DIV>(pA, strideA, pB, strideB, pOut, n); return true;
+				default: break;
+			}
+		}
+		break;
+		
+		default: break;
+	}
+#endif
+	
+	// No kernel applies
+	return false;
+}
+
+/***************************************************************
+* Function: SimdKernels::binaryC128()
+* Purpose : Apply a binary operation to complex arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SimdKernels::binaryC128(BinOp op, const Complex128* pA, bool scalarA, const Complex128* pB, bool scalarB, Complex128* pOut, size_t n)
+{
+	// Only addition and subtraction are handled, component-wise
+	if (op != OP_ADD && op != OP_SUB)
+		return false;
+	
+	// If neither operand is a scalar, operate on the real and imaginary parts as float64 arrays
+	if (!scalarA && !scalarB)
+	{
+		return binaryF64(
+			op,
+			reinterpret_cast<const float64*>(pA), false,
+			reinterpret_cast<const float64*>(pB), false,
+			reinterpret_cast<float64*>(pOut),
+			2 * n
+		);
+	}
+	
+#ifdef SIMD_X86_64
+	// If vector instructions are enabled
+	if (getLevel() != LEVEL_NONE)
+	{
+		// Get the operand strides, scalars are broadcast
+		size_t strideA = scalarA? 0:1;
+		size_t strideB = scalarB? 0:1;
+		
+		// Apply the operation one complex element at a time
+		if (op == OP_ADD)
+			binaryC128Sse2<OP_ADD>(pA, strideA, pB, strideB, pOut, n);
+		else
+			binaryC128Sse2<OP_SUB>(pA, strideA, pB, strideB, pOut, n);
+		return true;
+	}
+#endif
+	
+	// No kernel applies
+	return false;
+}
+
+/***************************************************************
+* Function: SimdKernels::binaryBool()
+* Purpose : Apply a binary operation to logical arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SimdKernels::binaryBool(BinOp op, const bool* pA, bool scalarA, const bool* pB, bool scalarB, bool* pOut, size_t n)
+{
+#ifdef SIMD_X86_64
+	// Only logical AND and OR are handled
+	if (op != OP_AND && op != OP_OR)
+		return false;
+	
+	// Get the operand strides, scalars are broadcast
+	size_t strideA = scalarA? 0:1;
+	size_t strideB = scalarB? 0:1;
+	
+	// Switch on the instruction set level
+	switch (getLevel())
+	{
+		case LEVEL_AVX2:
+		{
+			if (op == OP_AND)
+				binaryBoolAvx2<OP_AND>(pA, strideA, pB, strideB, pOut, n);
+			else
+				binaryBoolAvx2<OP_OR>(pA, strideA, pB, strideB, pOut, n);
+		}
+		return true;
+		
+		case LEVEL_SSE2:
+		{
+			if (op == OP_AND)
+				binaryBoolSse2<OP_AND>(pA, strideA, pB, strideB, pOut, n);
+			else
+				binaryBoolSse2<OP_OR>(pA, strideA, pB, strideB, pOut, n);
+		}
+		return true;
+		
+		default: break;
+	}
+#endif
+	
+	// No kernel applies
+	return false;
+}
+
+/***************************************************************
+* Function: SimdKernels::unaryF64()
+* Purpose : Apply a unary operation to a float64 array
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SimdKernels::unaryF64(UnOp op, const float64* pIn, float64* pOut, size_t n)
+{
+#ifdef SIMD_X86_64
+	// Switch on the instruction set level
+	switch (getLevel())
+	{
+		case LEVEL_AVX2:
+		{
+			if (op == OP_SQRT)
+				unaryF64Avx2<OP_SQRT>(pIn, pOut, n);
+			else
+				unaryF64Avx2<OP_ABS>(pIn, pOut, n);
+		}
+		return true;
+		
+		case LEVEL_SSE2:
+		{
+			if (op == OP_SQRT)
+				unaryF64Sse2<OP_SQRT>(pIn, pOut, n);
+			else
+				unaryF64Sse2<OP_ABS>(pIn, pOut, n);
+		}
+		return true;
+		
+		default: break;
+	}
+#endif
+	
+	// No kernel applies
+	return false;
+}
@@ -0,0 +1,213 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef SIMDKERNELS_H_
+#define SIMDKERNELS_H_
+
+// Header files
+#include <cstddef>
+#include "platform.h"
+#include "configmanager.h"
+
+// Forward declarations of the operator function objects
+template <class ScalarType> class AddOp;
+template <class ScalarType> class SubOp;
+template <class ScalarType> class MultOp;
+template <class ScalarType> class DivOp;
+template <class ScalarType> class AndOp;
+template <class ScalarType> class OrOp;
+template <class ScalarType> class SqrtOp;
+template <class InType, class OutType> class AbsOp;
+
+/***************************************************************
+* Class   : SimdKernels
+* Purpose : Vectorized array kernels with runtime CPU dispatch
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class SimdKernels
+{
+public:
+	
+	// Instruction set levels
+	enum Level
+	{
+		LEVEL_NONE = 0,
+		LEVEL_SSE2 = 1,
+		LEVEL_AVX2 = 2
+	};
+	
+	// Binary operations
+	enum BinOp
+	{
+		OP_ADD,
+		OP_SUB,
+		OP_MULT,
+		OP_DIV,
+		OP_AND,
+		OP_OR
+	};
+	
+	// Unary operations
+	enum UnOp
+	{
+		OP_SQRT,
+		OP_ABS
+	};
+	
+	// Method to initialize the kernels and detect the CPU features
+	static void initialize();
+	
+	// Method to get the instruction set level currently in use
+	static Level getLevel();
+	
+	// Method to get the name of an instruction set level
+	static const char* getLevelName(Level level);
+	
+	// Binary operation kernels, a scalar operand is broadcast to every element
+	static bool binaryF64(BinOp op, const float64* pA, bool scalarA, const float64* pB, bool scalarB, float64* pOut, size_t n);
+	static bool binaryF32(BinOp op, const float32* pA, bool scalarA, const float32* pB, bool scalarB, float32* pOut, size_t n);
+	static bool binaryC128(BinOp op, const Complex128* pA, bool scalarA, const Complex128* pB, bool scalarB, Complex128* pOut, size_t n);
+	static bool binaryBool(BinOp op, const bool* pA, bool scalarA, const bool* pB, bool scalarB, bool* pOut, size_t n);
+	
+	// Unary operation kernels
+	static bool unaryF64(UnOp op, const float64* pIn, float64* pOut, size_t n);
+	
+	// Config variable to enable/disable the vectorized kernels
+	static ConfigVar s_simdEnableVar;
+	
+	// Config variable for the highest instruction set level to use
+	static ConfigVar s_simdMaxLevelVar;
+	
+private:
+	
+	// Highest instruction set level supported by the CPU
+	static Level s_cpuLevel;
+};
+
+/***************************************************************
+* Class   : ArrayKernel
+* Purpose : Select the vectorized kernel for an array operation
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class Op, class InType, class OutType> class ArrayKernel
+{
+public:
+	
+	// Method to apply a binary operation, returns false if there is no kernel
+	static bool binary(const InType* pA, bool scalarA, const InType* pB, bool scalarB, OutType* pOut, size_t n) { return false; }
+	
+	// Method to apply a unary operation, returns false if there is no kernel
+	static bool unary(const InType* pIn, OutType* pOut, size_t n) { return false; }
+};
+
+// Macro to map a binary operator function object to a kernel
+#define SIMD_BINARY_KERNEL(OP, TYPE, KERNEL, CODE)													\
+template <> class ArrayKernel<OP<TYPE>, TYPE, TYPE>													\
+{																									\
+public:																								\
+	static bool binary(const TYPE* pA, bool scalarA, const TYPE* pB, bool scalarB, TYPE* pOut, size_t n)	\
+	{ return SimdKernels::KERNEL(SimdKernels::CODE, pA, scalarA, pB, scalarB, pOut, n); }			\
+	static bool unary(const TYPE* pIn, TYPE* pOut, size_t n) { return false; }						\
+};
+
+// Binary kernels for 64-bit floating-point arrays
+SIMD_BINARY_KERNEL(AddOp, float64, binaryF64, OP_ADD)
+SIMD_BINARY_KERNEL(SubOp, float64, binaryF64, OP_SUB)
+SIMD_BINARY_KERNEL(MultOp, float64, binaryF64, OP_MULT)
+SIMD_BINARY_KERNEL(DivOp, float64, binaryF64, OP_DIV)
+
+// Binary kernels for 32-bit floating-point arrays
+SIMD_BINARY_KERNEL(AddOp, float32, binaryF32, OP_ADD)
+SIMD_BINARY_KERNEL(SubOp, float32, binaryF32, OP_SUB)
+SIMD_BINARY_KERNEL(MultOp, float32, binaryF32, OP_MULT)
+SIMD_BINARY_KERNEL(DivOp, float32, binaryF32, OP_DIV)
+
+// Binary kernels for 128-bit complex arrays
+// NOTE: complex multiplication and division keep the scalar code, which
+//       implements the C99 rules for infinite and NaN operands
+SIMD_BINARY_KERNEL(AddOp, Complex128, binaryC128, OP_ADD)
+SIMD_BINARY_KERNEL(SubOp, Complex128, binaryC128, OP_SUB)
+
+#undef SIMD_BINARY_KERNEL
+
+/***************************************************************
+* Class   : ArrayKernel<AndOp<bool>, bool, bool>
+* Purpose : Kernel for the logical AND of logical arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> class ArrayKernel<AndOp<bool>, bool, bool>
+{
+public:
+	static bool binary(const bool* pA, bool scalarA, const bool* pB, bool scalarB, bool* pOut, size_t n)
+	{ return SimdKernels::binaryBool(SimdKernels::OP_AND, pA, scalarA, pB, scalarB, pOut, n); }
+	static bool unary(const bool* pIn, bool* pOut, size_t n) { return false; }
+};
+
+/***************************************************************
+* Class   : ArrayKernel<OrOp<bool>, bool, bool>
+* Purpose : Kernel for the logical OR of logical arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> class ArrayKernel<OrOp<bool>, bool, bool>
+{
+public:
+	static bool binary(const bool* pA, bool scalarA, const bool* pB, bool scalarB, bool* pOut, size_t n)
+	{ return SimdKernels::binaryBool(SimdKernels::OP_OR, pA, scalarA, pB, scalarB, pOut, n); }
+	static bool unary(const bool* pIn, bool* pOut, size_t n) { return false; }
+};
+
+/***************************************************************
+* Class   : ArrayKernel<SqrtOp<float64>, float64, float64>
+* Purpose : Kernel for the square root of float64 arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> class ArrayKernel<SqrtOp<float64>, float64, float64>
+{
+public:
+	static bool binary(const float64* pA, bool scalarA, const float64* pB, bool scalarB, float64* pOut, size_t n) { return false; }
+	static bool unary(const float64* pIn, float64* pOut, size_t n)
+	{ return SimdKernels::unaryF64(SimdKernels::OP_SQRT, pIn, pOut, n); }
+};
+
+/***************************************************************
+* Class   : ArrayKernel<AbsOp<float64, float64>, float64, float64>
+* Purpose : Kernel for the absolute value of float64 arrays
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> class ArrayKernel<AbsOp<float64, float64>, float64, float64>
+{
+public:
+	static bool binary(const float64* pA, bool scalarA, const float64* pB, bool scalarB, float64* pOut, size_t n) { return false; }
+	static bool unary(const float64* pIn, float64* pOut, size_t n)
+	{ return SimdKernels::unaryF64(SimdKernels::OP_ABS, pIn, pOut, n); }
+};
+
+#endif // #ifndef SIMDKERNELS_H_
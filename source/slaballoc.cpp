@@ -0,0 +1,100 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cstring>
+#include <new>
+#include <gc.h>
+#include "slaballoc.h"
+#include "profiling.h"
+
+// Free object lists, one per size class
+void* SlabAlloc::s_freeLists[SlabAlloc::NUM_CLASSES] = { NULL };
+
+/***************************************************************
+* Function: SlabAlloc::allocate()
+* Purpose : Allocate a collectable object
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void* SlabAlloc::allocate(size_t size)
+{
+	// Increment the slab allocation count
+	PROF_INCR_COUNTER(Profiler::SLAB_ALLOC_COUNT);
+	
+	// Large objects are allocated by the GC directly
+	if (size == 0 || size > MAX_SLAB_SIZE)
+		return GC_MALLOC(size);
+	
+	// Get the free list for this size class
+	void*& pFreeList = s_freeLists[sizeClass(size)];
+	
+	// If the free list is empty
+	if (pFreeList == NULL)
+	{
+		// Get a batch of cleared objects of this size class from the GC,
+		// this takes the allocation lock once for the whole batch. The
+		// free list is a root, so the batch is not collected meanwhile.
+		pFreeList = GC_malloc_many((sizeClass(size) + 1) * GRANULE_SIZE);
+		
+		// If the allocation failed, report it
+		if (pFreeList == NULL)
+			throw std::bad_alloc();
+		
+		// Increment the slab refill count
+		PROF_INCR_COUNTER(Profiler::SLAB_REFILL_COUNT);
+	}
+	
+	// Unlink the first object from the free list
+	void* pObject = pFreeList;
+	pFreeList = GC_NEXT(pObject);
+	GC_NEXT(pObject) = NULL;
+	
+	// Return the object
+	return pObject;
+}
+
+/***************************************************************
+* Function: SlabAlloc::deallocate()
+* Purpose : Give back an object that is known to be dead
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void SlabAlloc::deallocate(void* pObject, size_t size)
+{
+	// Deleting a null pointer does nothing
+	if (pObject == NULL)
+		return;
+	
+	// Large objects are freed by the GC directly
+	if (size == 0 || size > MAX_SLAB_SIZE)
+	{
+		GC_FREE(pObject);
+		return;
+	}
+	
+	// Clear the object so that stale pointers do not retain garbage
+	memset(pObject, 0, (sizeClass(size) + 1) * GRANULE_SIZE);
+	
+	// Push the object on the free list of its size class
+	void*& pFreeList = s_freeLists[sizeClass(size)];
+	GC_NEXT(pObject) = pFreeList;
+	pFreeList = pObject;
+}
@@ -0,0 +1,62 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef SLABALLOC_H_
+#define SLABALLOC_H_
+
+// Header files
+#include <cstddef>
+#include "platform.h"
+
+/***************************************************************
+* Class   : SlabAlloc
+* Purpose : Size-class allocator for small garbage-collected objects
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class SlabAlloc
+{
+public:
+	
+	// Size class granularity, in bytes
+	static const size_t GRANULE_SIZE = 16;
+	
+	// Number of size classes, objects above the largest go to the GC directly
+	static const size_t NUM_CLASSES = 16;
+	
+	// Largest object size served from the slabs
+	static const size_t MAX_SLAB_SIZE = GRANULE_SIZE * NUM_CLASSES;
+	
+	// Method to allocate a collectable object
+	static void* allocate(size_t size);
+	
+	// Method to give back an object that is known to be dead
+	static void deallocate(void* pObject, size_t size);
+	
+private:
+	
+	// Method to get the size class of an object size
+	static size_t sizeClass(size_t size) { return (size + GRANULE_SIZE - 1) / GRANULE_SIZE - 1; }
+	
+	// Free object lists, one per size class
+	static void* s_freeLists[NUM_CLASSES];
+};
+
+#endif // #ifndef SLABALLOC_H_
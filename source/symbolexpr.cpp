@@ -88,6 +88,7 @@ std::string SymbolExpr::toString() const
 Revisions and bug fixes:
 */
 SymbolExpr::SymbolExpr(const std::string& name)
+: m_symId(s_nameMap.size())
 {
 	// Set the expression type
 	m_exprType = SYMBOL;
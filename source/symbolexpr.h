@@ -52,6 +52,9 @@ public:
 	// Accessor to get the symbol name
 	const std::string& getSymName() const { return m_symName; }
 	
+	// Accessor to get the unique number of this symbol
+	size_t getSymId() const { return m_symId; }
+	
 private:
 	
 	// Private constructor
@@ -63,6 +66,9 @@ private:
 	// Name string for this symbol
 	std::string m_symName;
 	
+	// Unique number of this symbol, used to index slot layouts
+	size_t m_symId;
+	
 	// Static symbol name map
 	static NameMap s_nameMap;
 };
@@ -26,6 +26,7 @@
 #include "binaryopexpr.h"
 #include "symbolexpr.h"
 #include "ifelsestmt.h"
+#include "arrayfusion.h"
 
 /***************************************************************
 * Function: splitSequence()
@@ -259,10 +260,19 @@ bool splitExpression(Expression* pExpr, StmtSequence::StmtVector& stmtVector, Ex
 		if (!exprSplit)
 			continue;
 		
+		// If the current expression and the sub-expression are both
+		// fusable element-wise operations, keep the tree together so
+		// that it can be evaluated in a single fused pass
+		if (FusedArrayOp::s_fuseArrayOpsVar.getBoolValue() == true &&
+			FusedArrayOp::isFusableOp(pTopExpr) && FusedArrayOp::isFusableOp(pTopSubExpr))
+		{
+			// Replace the sub-expression by the top sub-expression directly
+			pTopExpr->replaceSubExpr(i, pTopSubExpr);
+		}
 		// If the current expression is a parameterized or
 		// cell indexing expression and the sub-expression
 		// is a range expressions
-		if ((pTopExpr->getExprType() == Expression::PARAM ||
+		else if ((pTopExpr->getExprType() == Expression::PARAM ||
 			pTopExpr->getExprType() == Expression::CELL_INDEX) &&
 			pTopSubExpr->getExprType() == Expression::RANGE)
 		{
@@ -116,23 +116,10 @@ TypeInfo::TypeInfo(const DataObject* pObject, bool storeMatDims, bool scanMatric
 			if (pMatrixObj->getType() == DataObject::MATRIX_F64 && scanMatrices)
 			{
 				// Get a typed pointer to the matrix
-				MatrixF64Obj* pF64Matrix = (MatrixF64Obj*)pMatrixObj;
+				const MatrixF64Obj* pF64Matrix = (const MatrixF64Obj*)pMatrixObj;
 				
-				// Initially, set the integer flag to true
-				m_isInteger = true;
-				
-				// For each value in the matrix
-				const float64* pLastElem = pF64Matrix->getElements() + pF64Matrix->getNumElems();
-				for (float64* pValue = pF64Matrix->getElements(); pValue < pLastElem; ++pValue)
-				{
-					// If this value is not integer
-					if (::isInteger(*pValue) == false)
-					{
-						// Set the integer flag to false and break out of the loop
-						m_isInteger = false;
-						break;
-					}
-				}				
+				// Set the integer flag using the matrix's cached test
+				m_isInteger = pF64Matrix->isAllInteger();
 			}
 		}
 		
@@ -187,6 +174,45 @@ TypeInfo::TypeInfo(const DataObject* pObject, bool storeMatDims, bool scanMatric
 	}
 }
 
+/***************************************************************
+* Function: static TypeInfo::getTypeTag()
+* Purpose : Compute a compact tag for the type of an object
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+uint32 TypeInfo::getTypeTag(const DataObject* pObject)
+{
+	// Only non-cell matrices have a type fully described by the tag,
+	// return the null tag for all other objects
+	if (pObject->isMatrixObj() == false || pObject->getType() == DataObject::CELLARRAY)
+		return 0;
+	
+	// Get a typed pointer to the matrix
+	const BaseMatrixObj* pMatrixObj = (const BaseMatrixObj*)pObject;
+	
+	// Compute the flags as TypeInfo(pObject, false, true) would
+	bool is2D = pMatrixObj->is2D();
+	bool isScalar = pMatrixObj->isScalar();
+	bool isInteger = false;
+	
+	// If this is a 64-bit float matrix
+	if (pObject->getType() == DataObject::MATRIX_F64)
+	{
+		// Test whether all the values in the matrix are integer
+		isInteger = ((const MatrixF64Obj*)pObject)->isAllInteger();
+	}
+	
+	// Otherwise, logical and character arrays are integer
+	else if (pObject->getType() == DataObject::LOGICALARRAY || pObject->getType() == DataObject::CHARARRAY)
+	{
+		isInteger = true;
+	}
+	
+	// Combine the object type and flags into a non-null tag
+	return (uint32(pObject->getType()) + 1) | (uint32(is2D) << 8) | (uint32(isScalar) << 9) | (uint32(isInteger) << 10);
+}
+
 /***************************************************************
 * Function: TypeInfo::TypeInfo(...) 
 * Purpose : Full constructor for the type info class
@@ -71,6 +71,9 @@ public:
 	
 	// Less-than comparison operator (for sorting)
 	bool operator < (const TypeInfo& other) const;
+	
+	// Static method to compute a compact tag for the type of an object
+	static uint32 getTypeTag(const DataObject* pObject);
 
 	// Mutator to set the object type identifier
 	void setObjType(DataObject::Type type) { m_objType = type; }
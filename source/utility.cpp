@@ -17,7 +17,13 @@
 // =========================================================================== //
 
 // Header files
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
 #include "utility.h"
 
 /***************************************************************
@@ -260,3 +266,140 @@ bool readTextFile(const std::string& fileName, std::string& output)
 	// File read successfully
 	return true;
 }
+
+/***************************************************************
+* Function: readBinaryFile()
+* Purpose : Read an entire file into a string
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool readBinaryFile(const std::string& fileName, std::string& output)
+{
+	// Attempt to open the file in binary reading mode
+	FILE* pFile = fopen(fileName.c_str(), "rb");
+
+	// Make sure that the file was successfully opened
+	if (!pFile)
+		return false;
+
+	// Seek to the end of the file and get its size
+	fseek(pFile, 0, SEEK_END);
+	long fileSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	// If the size could not be obtained, abort
+	if (fileSize < 0)
+	{
+		fclose(pFile);
+		return false;
+	}
+
+	// Read the file into the output string
+	output.resize(fileSize);
+	size_t sizeRead = fileSize? fread(&output[0], 1, fileSize, pFile):0;
+
+	// Close the input file
+	fclose(pFile);
+
+	// Make sure the file was entirely read
+	return (sizeRead == size_t(fileSize));
+}
+
+/***************************************************************
+* Function: appendUInt64()
+* Purpose : Append a 64-bit value to a cache entry
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void appendUInt64(std::string& output, uint64 value)
+{
+	// Write the value in little-endian byte order
+	for (size_t i = 0; i < sizeof(uint64); ++i)
+		output += char((value >> (8 * i)) & 0xFF);
+}
+
+/***************************************************************
+* Function: readUInt64()
+* Purpose : Read a 64-bit value from a cache entry
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+uint64 readUInt64(const std::string& input, size_t& charIndex)
+{
+	// Ensure that the value lies within the input
+	assert (charIndex + sizeof(uint64) <= input.length());
+
+	// Read the value in little-endian byte order
+	uint64 value = 0;
+	for (size_t i = 0; i < sizeof(uint64); ++i)
+		value |= uint64((unsigned char)input[charIndex++]) << (8 * i);
+
+	// Return the value
+	return value;
+}
+
+/***************************************************************
+* Function: getCacheEntryPath()
+* Purpose : Get the path of an on-disk cache entry
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string getCacheEntryPath(const std::string& cacheDir, uint64 keyHash, const std::string& extension)
+{
+	// Use the configured cache directory, if any
+	std::string entryDir = cacheDir;
+
+	// If no directory was specified
+	if (entryDir.empty())
+	{
+		// Use a directory in the user's home, or the working directory
+		const char* pHomeDir = getenv("HOME");
+		entryDir = std::string(pHomeDir? pHomeDir:".") + "/.mcvm_cache";
+	}
+
+	// Format the key hash as a hexadecimal number
+	char hashStr[32];
+	sprintf(hashStr, "%016llx", (unsigned long long)keyHash);
+
+	// Return the entry path
+	return entryDir + "/" + hashStr + extension;
+}
+
+/***************************************************************
+* Function: writeCacheEntry()
+* Purpose : Write an on-disk cache entry
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool writeCacheEntry(const std::string& entryPath, const std::string& entry)
+{
+	// Create the cache directory, if it does not already exist
+	mkdir(entryPath.substr(0, entryPath.rfind('/')).c_str(), 0755);
+
+	// Write the entry to a temporary file, so that readers never see partial entries
+	std::string tempPath = entryPath + ".tmp" + ::toString(getpid());
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+
+	// If the file could not be created, abort the operation
+	if (!pFile)
+		return false;
+
+	// Write the entry contents
+	size_t result = fwrite(entry.data(), entry.length(), 1, pFile);
+	fclose(pFile);
+
+	// If the write failed, remove the temporary file
+	if (result != 1)
+	{
+		remove(tempPath.c_str());
+		return false;
+	}
+
+	// Move the entry into place
+	return (rename(tempPath.c_str(), entryPath.c_str()) == 0);
+}
@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 #include <cstdio>
+#include "platform.h"
 
 // Floating-point infinity constants
 const float FLOAT_INFINITY = std::numeric_limits<float>::infinity();
@@ -291,4 +292,19 @@ std::vector<std::string> tokenize(const std::string& input, const std::string& d
 // Function to read a text file into a string
 bool readTextFile(const std::string& fileName, std::string& output);
 
+// Function to read an entire binary file into a string
+bool readBinaryFile(const std::string& fileName, std::string& output);
+
+// Function to append a 64-bit value to a binary string
+void appendUInt64(std::string& output, uint64 value);
+
+// Function to read a 64-bit value from a binary string
+uint64 readUInt64(const std::string& input, size_t& charIndex);
+
+// Function to get the path of an on-disk cache entry
+std::string getCacheEntryPath(const std::string& cacheDir, uint64 keyHash, const std::string& extension);
+
+// Function to write an on-disk cache entry
+bool writeCacheEntry(const std::string& entryPath, const std::string& entry);
+
 #endif // #ifndef UTILITY_H_ 
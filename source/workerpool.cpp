@@ -0,0 +1,288 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Worker threads register themselves with the collector explicitly
+#define GC_THREADS
+#define GC_NO_THREAD_REDIRECTS
+
+// Header files
+#include <gc.h>
+#include <unistd.h>
+#include <algorithm>
+#include "workerpool.h"
+
+// Config variable for the number of threads (0 means one per core)
+ConfigVar WorkerPool::s_numThreadsVar("num_threads", ConfigVar::INT, "0", 0, 256);
+
+// Config variable for the element count above which work is split
+ConfigVar WorkerPool::s_parallelThresholdVar("parallel_threshold", ConfigVar::INT, "200000", 1);
+
+// Worker thread handles
+std::vector<pthread_t> WorkerPool::s_workers;
+
+// Mutex and conditions protecting the job state
+pthread_mutex_t WorkerPool::s_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t WorkerPool::s_jobCond = PTHREAD_COND_INITIALIZER;
+pthread_cond_t WorkerPool::s_doneCond = PTHREAD_COND_INITIALIZER;
+
+// Current job state
+uint64 WorkerPool::s_jobId = 0;
+WorkerPool::TaskFunc WorkerPool::s_pTaskFunc = NULL;
+void* WorkerPool::s_pTaskData = NULL;
+size_t WorkerPool::s_numItems = 0;
+size_t WorkerPool::s_numChunks = 0;
+size_t WorkerPool::s_nextChunk = 0;
+size_t WorkerPool::s_chunksDone = 0;
+RunError* WorkerPool::s_pError = NULL;
+bool WorkerPool::s_jobActive = false;
+
+/***************************************************************
+* Function: WorkerPool::initialize()
+* Purpose : Initialize the worker pool
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::initialize()
+{
+	// Register the local config variables
+	ConfigManager::registerVar(&s_numThreadsVar);
+	ConfigManager::registerVar(&s_parallelThresholdVar);
+	
+	// The worker threads are started lazily, once the
+	// command-line arguments have set the thread count
+}
+
+/***************************************************************
+* Function: WorkerPool::getNumThreads()
+* Purpose : Get the number of threads to use
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t WorkerPool::getNumThreads()
+{
+	// Get the configured thread count
+	long int numThreads = s_numThreadsVar.getIntValue();
+	
+	// If no count was specified, use one thread per online core
+	if (numThreads <= 0)
+		numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+	
+	// Always use at least the main thread
+	return (size_t)std::max(numThreads, 1L);
+}
+
+/***************************************************************
+* Function: WorkerPool::parallelFor()
+* Purpose : Run a range task, split across the pool if large
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::parallelFor(size_t numItems, size_t itemCost, TaskFunc pFunc, void* pData)
+{
+	// Compute the number of chunks to split the work into
+	size_t numChunks = 1;
+	if (numItems * itemCost >= (size_t)s_parallelThresholdVar.getIntValue())
+		numChunks = std::min(getNumThreads(), numItems);
+	
+	// If the work is not worth splitting, run it on this thread
+	if (numChunks <= 1)
+	{
+		pFunc(pData, 0, numItems);
+		return;
+	}
+	
+	// Lock the job state
+	pthread_mutex_lock(&s_mutex);
+	
+	// If a job is already in progress, run this one on the current thread
+	if (s_jobActive)
+	{
+		pthread_mutex_unlock(&s_mutex);
+		pFunc(pData, 0, numItems);
+		return;
+	}
+	
+	// Start the worker threads needed for this job
+	startWorkers(numChunks - 1);
+	
+	// Post the job, the partition into chunks depends only
+	// on the item and chunk counts, so that every element
+	// is computed the same way regardless of scheduling
+	s_pTaskFunc = pFunc;
+	s_pTaskData = pData;
+	s_numItems = numItems;
+	s_numChunks = numChunks;
+	s_nextChunk = 0;
+	s_chunksDone = 0;
+	s_pError = NULL;
+	s_jobActive = true;
+	++s_jobId;
+	
+	// Wake up the worker threads
+	pthread_cond_broadcast(&s_jobCond);
+	pthread_mutex_unlock(&s_mutex);
+	
+	// Take part in the job on this thread
+	runChunks();
+	
+	// Wait for the remaining chunks to complete
+	pthread_mutex_lock(&s_mutex);
+	while (s_chunksDone < s_numChunks)
+		pthread_cond_wait(&s_doneCond, &s_mutex);
+	
+	// Mark the job as completed and collect its error, if any
+	s_jobActive = false;
+	RunError* pError = s_pError;
+	s_pError = NULL;
+	pthread_mutex_unlock(&s_mutex);
+	
+	// If a chunk raised an error, rethrow it on this thread
+	if (pError != NULL)
+	{
+		RunError error = *pError;
+		delete pError;
+		throw error;
+	}
+}
+
+/***************************************************************
+* Function: WorkerPool::startWorkers()
+* Purpose : Start worker threads until the pool is large enough
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::startWorkers(size_t numWorkers)
+{
+	// If the pool is already large enough, do nothing
+	if (s_workers.size() >= numWorkers)
+		return;
+	
+	// Allow threads to register themselves with the collector
+	if (s_workers.empty())
+		GC_allow_register_threads();
+	
+	// Create the missing worker threads
+	while (s_workers.size() < numWorkers)
+	{
+		pthread_t thread;
+		
+		// If the thread could not be created, make do with the current pool
+		if (pthread_create(&thread, NULL, &workerMain, NULL) != 0)
+			break;
+		
+		// The workers live until the process exits
+		pthread_detach(thread);
+		s_workers.push_back(thread);
+	}
+}
+
+/***************************************************************
+* Function: WorkerPool::runChunks()
+* Purpose : Run chunks of the current job until none remain
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::runChunks()
+{
+	// Until all chunks have been claimed
+	for (;;)
+	{
+		// Claim the next chunk of the current job
+		pthread_mutex_lock(&s_mutex);
+		if (!s_jobActive || s_nextChunk >= s_numChunks)
+		{
+			pthread_mutex_unlock(&s_mutex);
+			return;
+		}
+		size_t chunk = s_nextChunk++;
+		TaskFunc pFunc = s_pTaskFunc;
+		void* pData = s_pTaskData;
+		size_t numItems = s_numItems;
+		size_t numChunks = s_numChunks;
+		pthread_mutex_unlock(&s_mutex);
+		
+		// Compute the item range of this chunk
+		size_t begin = (numItems * chunk) / numChunks;
+		size_t end = (numItems * (chunk + 1)) / numChunks;
+		
+		// Process the chunk, keeping any error for the main thread
+		RunError* pError = NULL;
+		try
+		{
+			pFunc(pData, begin, end);
+		}
+		catch (RunError error)
+		{
+			pError = new RunError(error);
+		}
+		
+		// Record the completion of this chunk
+		pthread_mutex_lock(&s_mutex);
+		if (pError != NULL && s_pError == NULL)
+			s_pError = pError;
+		else
+			delete pError;
+		if (++s_chunksDone == s_numChunks)
+			pthread_cond_broadcast(&s_doneCond);
+		pthread_mutex_unlock(&s_mutex);
+	}
+}
+
+/***************************************************************
+* Function: WorkerPool::workerMain()
+* Purpose : Entry point of the worker threads
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void* WorkerPool::workerMain(void* pArg)
+{
+	// Register this thread with the garbage collector so that
+	// its stack is scanned and it may allocate collected memory
+	GC_stack_base stackBase;
+	GC_get_stack_base(&stackBase);
+	GC_register_my_thread(&stackBase);
+	
+	// Start waiting for the next job to be posted
+	pthread_mutex_lock(&s_mutex);
+	uint64 lastJobId = s_jobId;
+	
+	// For each job posted
+	for (;;)
+	{
+		// Wait for a new job
+		while (s_jobId == lastJobId)
+			pthread_cond_wait(&s_jobCond, &s_mutex);
+		lastJobId = s_jobId;
+		pthread_mutex_unlock(&s_mutex);
+		
+		// Take part in the job
+		runChunks();
+		
+		// Lock the job state before waiting again
+		pthread_mutex_lock(&s_mutex);
+	}
+	
+	// The workers never exit
+	return NULL;
+}
@@ -0,0 +1,105 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+// Header files
+#include <cstddef>
+#include <vector>
+#include <pthread.h>
+#include "platform.h"
+#include "configmanager.h"
+#include "runtimebase.h"
+
+/***************************************************************
+* Class   : WorkerPool
+* Purpose : Pool of worker threads splitting array work across cores
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class WorkerPool
+{
+public:
+	
+	// Range task function type, processes the items in [begin, end)
+	typedef void (*TaskFunc)(void* pData, size_t begin, size_t end);
+	
+	// Method to initialize the worker pool
+	static void initialize();
+	
+	// Method to run a range task, split across the pool if large enough
+	static void parallelFor(size_t numItems, size_t itemCost, TaskFunc pFunc, void* pData);
+	
+	// Method to get the number of threads to use, including the main thread
+	static size_t getNumThreads();
+	
+	// Config variable for the number of threads (0 means one per core)
+	static ConfigVar s_numThreadsVar;
+	
+	// Config variable for the element count above which work is split
+	static ConfigVar s_parallelThresholdVar;
+	
+private:
+	
+	// Method to start worker threads until the pool has the requested size
+	static void startWorkers(size_t numWorkers);
+	
+	// Method to run the chunks of the current job until none remain
+	static void runChunks();
+	
+	// Entry point of the worker threads
+	static void* workerMain(void* pArg);
+	
+	// Worker thread handles
+	static std::vector<pthread_t> s_workers;
+	
+	// Mutex protecting the job state
+	static pthread_mutex_t s_mutex;
+	
+	// Condition signaled when a new job is posted
+	static pthread_cond_t s_jobCond;
+	
+	// Condition signaled when the last chunk of a job completes
+	static pthread_cond_t s_doneCond;
+	
+	// Current job identifier, incremented for each job
+	static uint64 s_jobId;
+	
+	// Current job task function and data
+	static TaskFunc s_pTaskFunc;
+	static void* s_pTaskData;
+	
+	// Current job item and chunk counts
+	static size_t s_numItems;
+	static size_t s_numChunks;
+	
+	// Next chunk to be claimed and number of chunks completed
+	static size_t s_nextChunk;
+	static size_t s_chunksDone;
+	
+	// First error raised by a chunk of the current job, if any
+	static RunError* s_pError;
+	
+	// Flag indicating a job is in progress
+	static bool s_jobActive;
+};
+
+#endif // #ifndef WORKERPOOL_H_
@@ -19,6 +19,7 @@
 // Header files
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 #include <ctype.h>
 #include <sstream>
 #include <iostream>
@@ -29,6 +30,22 @@
 // Include this in the XML namespace
 namespace XML
 {
+	// Signature and version of the binary XML encoding
+	static const char BINARY_SIGNATURE[] = "\x7FMXB";
+	static const size_t BINARY_SIGNATURE_LENGTH = 4;
+	static const unsigned char BINARY_VERSION = 1;
+	
+	// Node kind tags used in the binary XML encoding
+	enum BinaryNodeKind
+	{
+		BIN_ELEMENT = 1,
+		BIN_TEXT,
+		BIN_RAWDATA
+	};
+	
+	// String table type definition for the binary encoder
+	typedef std::map<std::string, size_t> StringTable;
+	
 	/***************************************************************
 	* Function: TextPos::toString()
 	* Purpose : Produce a string representation of the position
@@ -1492,6 +1509,421 @@ namespace XML
 		return new Text(text);
 	}
 	
+	/***************************************************************
+	* Function: Parser::parseStream()
+	* Purpose : Parse an XML input string in streaming mode
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void Parser::parseStream(const std::string& xmlString, StreamHandler& handler)
+	{
+		// Create a streaming parser working directly on the input
+		StreamParser parser(xmlString.data(), xmlString.length());
+		
+		// Parse the input, reporting events to the handler
+		parser.parse(handler);
+	}
+	
+	/***************************************************************
+	* Function: StrRef::toString()
+	* Purpose : Obtain the referenced string, decoding escapes
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	std::string StrRef::toString() const
+	{
+		// If there are no escape sequences, copy the characters directly
+		if (!m_escaped)
+			return std::string(m_pData, m_length);
+		
+		// Declare a string for the decoded output
+		std::string output;
+		output.reserve(m_length);
+		
+		// For each character
+		for (size_t charIndex = 0; charIndex < m_length; ++charIndex)
+		{
+			// Extract the current character
+			char thisChar = m_pData[charIndex];
+			
+			// If this is not the beginning of an escape sequence
+			if (thisChar != '&')
+			{
+				// Add the character to the output
+				output += thisChar;
+				continue;
+			}
+			
+			// Find the end of the escape sequence
+			size_t endIndex = charIndex + 1;
+			while (endIndex < m_length && m_pData[endIndex] != ';')
+				++endIndex;
+			
+			// If the escape sequence is not terminated, throw an exception
+			if (endIndex >= m_length)
+				throw ParseError("Unexpected end of stream in escape sequence");
+			
+			// Extract the escape sequence
+			std::string escapeSeq(m_pData + charIndex + 1, endIndex - charIndex - 1);
+			
+			// Handle known escape sequences
+			if (escapeSeq == "amp")			output += '&';
+			else if (escapeSeq == "lt")		output += '<';
+			else if (escapeSeq == "gt")		output += '>';
+			else if (escapeSeq == "quot")	output += '\"';
+			
+			// Otherwise, the escape sequence is unknown
+			else
+				throw ParseError("Unknown escape sequence: " + escapeSeq);
+			
+			// Move past the escape sequence
+			charIndex = endIndex;
+		}
+		
+		// Return the decoded string
+		return output;
+	}
+	
+	/***************************************************************
+	* Function: StrRef::equals()
+	* Purpose : Compare the referenced characters with a string
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	bool StrRef::equals(const char* pString) const
+	{
+		// The strings are equal if all characters match and the string ends here
+		return strncmp(m_pData, pString, m_length) == 0 && pString[m_length] == '\0';
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::parse()
+	* Purpose : Parse the input, reporting events to a handler
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void StreamParser::parse(StreamHandler& handler)
+	{
+		// Start at the beginning of the input
+		m_charIndex = 0;
+		m_openTags.clear();
+		
+		// Skip the XML declaration, if present
+		skipSpace();
+		if (match("<?xml"))
+			m_charIndex = findToken("?>", "Unexpected end of stream inside declaration") + 2;
+		
+		// Variable to tell if the root element was opened
+		bool rootSeen = false;
+		
+		// Until the root element is closed
+		while (!rootSeen || !m_openTags.empty())
+		{
+			// Skip whitespace between nodes
+			skipSpace();
+			
+			// If we are past the length of the input stream
+			if (m_charIndex >= m_length)
+				error("Unexpected end of stream inside tag", m_charIndex);
+			
+			// If this is a comment
+			if (match("<!--"))
+			{
+				// Move past the comment closing
+				m_charIndex = findToken("-->", "Unexpected end of stream inside comment") + 3;
+			}
+			
+			// If this is a CDATA region
+			else if (match("<![CDATA["))
+			{
+				// Find the end of the region
+				size_t startIndex = m_charIndex + 9;
+				size_t endIndex = findToken("]]>", "Unexpected end of stream inside CDATA region");
+				
+				// Report the region contents
+				handler.rawData(StrRef(m_pInput + startIndex, endIndex - startIndex));
+				
+				// Move past the CDATA closing
+				m_charIndex = endIndex + 3;
+			}
+			
+			// If this is a closing tag
+			else if (match("</"))
+			{
+				// Parse the closing tag name
+				size_t tagIndex = m_charIndex;
+				m_charIndex += 2;
+				StrRef name = parseName("Invalid tag name");
+				
+				// If the tag names do not match, throw an exception
+				if (m_openTags.empty() ||
+					m_openTags.back().getLength() != name.getLength() ||
+					memcmp(m_openTags.back().getData(), name.getData(), name.getLength()) != 0)
+					error("Unmatching closing tag: \"/" + name.toString() + "\"", tagIndex);
+				
+				// If the closing tag does not end properly, throw an exception
+				skipSpace();
+				if (!match(">"))
+					error("Malformed closing tag", m_charIndex);
+				++m_charIndex;
+				
+				// Report the element closing
+				m_openTags.pop_back();
+				handler.endElement(name);
+			}
+			
+			// If this is an opening tag
+			else if (match("<"))
+			{
+				// Parse the tag name and attributes
+				size_t tagIndex = m_charIndex;
+				++m_charIndex;
+				StrRef name = parseName("Invalid tag name");
+				bool isLeaf = parseAttributes();
+				
+				// If the root element was already closed, throw an exception
+				if (rootSeen && m_openTags.empty())
+					error("Multiple root elements", tagIndex);
+				rootSeen = true;
+				
+				// Report the element opening
+				handler.startElement(name, m_attributes, tagIndex);
+				
+				// If this is a leaf tag, report its closing, otherwise keep it open
+				if (isLeaf)
+					handler.endElement(name);
+				else
+					m_openTags.push_back(name);
+			}
+			
+			// Otherwise, this is a text region
+			else
+			{
+				// If the text is outside of any element, throw an exception
+				if (m_openTags.empty())
+					error("Text outside of the root element", m_charIndex);
+				
+				// Find the end of the text, noting any escape sequences
+				size_t startIndex = m_charIndex;
+				bool escaped = false;
+				for (; m_charIndex < m_length && m_pInput[m_charIndex] != '<'; ++m_charIndex)
+					escaped = escaped || m_pInput[m_charIndex] == '&';
+				
+				// Trim the trailing whitespace
+				size_t endIndex = m_charIndex;
+				while (endIndex > startIndex && isspace(m_pInput[endIndex - 1]))
+					--endIndex;
+				
+				// Report the text region
+				handler.text(StrRef(m_pInput + startIndex, endIndex - startIndex, escaped));
+			}
+		}
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::getTextPos()
+	* Purpose : Compute the text position of an input offset
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	TextPos StreamParser::getTextPos(size_t offset) const
+	{
+		// Variables for the line number and the start of the line
+		size_t lineNumber = 1;
+		size_t lineStart = 0;
+		
+		// Count the newlines preceding the offset
+		for (size_t charIndex = 0; charIndex < offset && charIndex < m_length; ++charIndex)
+		{
+			// If this character is a newline
+			if (m_pInput[charIndex] == '\n')
+			{
+				// Increment the line number
+				++lineNumber;
+				
+				// Store the line start index
+				lineStart = charIndex + 1;
+			}
+		}
+		
+		// Return the text position
+		return TextPos(lineNumber, offset - lineStart + 1);
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::match()
+	* Purpose : Test if a token appears at the current index
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	bool StreamParser::match(const char* pToken) const
+	{
+		// Get the length of the token
+		size_t tokenLength = strlen(pToken);
+		
+		// Compare the token with the input at the current index
+		return m_charIndex + tokenLength <= m_length && memcmp(m_pInput + m_charIndex, pToken, tokenLength) == 0;
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::skipSpace()
+	* Purpose : Skip whitespace characters
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void StreamParser::skipSpace()
+	{
+		// Move past any whitespace characters
+		while (m_charIndex < m_length && isspace(m_pInput[m_charIndex]))
+			++m_charIndex;
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::findToken()
+	* Purpose : Find a token from the current index
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	size_t StreamParser::findToken(const char* pToken, const char* pErrorText)
+	{
+		// Get the length of the token
+		size_t tokenLength = strlen(pToken);
+		
+		// For each possible token position
+		for (size_t charIndex = m_charIndex; charIndex + tokenLength <= m_length; ++charIndex)
+		{
+			// If the token appears here, return its position
+			if (memcmp(m_pInput + charIndex, pToken, tokenLength) == 0)
+				return charIndex;
+		}
+		
+		// The token was not found
+		error(pErrorText, m_charIndex);
+		return m_length;
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::parseName()
+	* Purpose : Parse an XML tag or attribute name
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	StrRef StreamParser::parseName(const char* pErrorText)
+	{
+		// Move past the alphanumeric characters
+		size_t startIndex = m_charIndex;
+		while (m_charIndex < m_length && isalnum(m_pInput[m_charIndex]))
+			++m_charIndex;
+		
+		// If the name is empty, throw an exception
+		if (m_charIndex == startIndex)
+			error(pErrorText, startIndex);
+		
+		// Return a reference to the name
+		return StrRef(m_pInput + startIndex, m_charIndex - startIndex);
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::parseAttributes()
+	* Purpose : Parse the attributes of an opening tag
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	bool StreamParser::parseAttributes()
+	{
+		// Clear the attributes of the previous tag
+		m_attributes.clear();
+		
+		// For each attribute
+		for (;;)
+		{
+			// Skip the whitespace before the attribute
+			skipSpace();
+			
+			// If we are past the length of the input stream
+			if (m_charIndex >= m_length)
+				error("Unexpected end of stream inside opening tag", m_charIndex);
+			
+			// If this is the end of the opening tag
+			if (match(">"))
+			{
+				// Move past the tag end
+				++m_charIndex;
+				return false;
+			}
+			
+			// If this is the end of a leaf tag
+			if (match("/>"))
+			{
+				// Move past the tag end
+				m_charIndex += 2;
+				return true;
+			}
+			
+			// Parse the attribute name
+			size_t attribIndex = m_charIndex;
+			StrRef attribName = parseName("Invalid character inside opening tag");
+			
+			// Move past the equal sign and the opening quote
+			skipSpace();
+			if (!match("="))
+				error("Invalid character in attribute", m_charIndex);
+			++m_charIndex;
+			skipSpace();
+			if (!match("\""))
+				error("Invalid character in attribute", m_charIndex);
+			++m_charIndex;
+			
+			// Find the closing quote, noting any escape sequences
+			size_t startIndex = m_charIndex;
+			bool escaped = false;
+			for (; m_charIndex < m_length && m_pInput[m_charIndex] != '"'; ++m_charIndex)
+				escaped = escaped || m_pInput[m_charIndex] == '&';
+			
+			// If the value is not terminated, throw an exception
+			if (m_charIndex >= m_length)
+				error("Unexpected end of stream in attribute value", startIndex);
+			
+			// Create a reference to the value and move past the closing quote
+			StrRef attribValue(m_pInput + startIndex, m_charIndex - startIndex, escaped);
+			++m_charIndex;
+			
+			// If another attribute with this name was already parsed, throw an exception
+			for (AttribRefList::const_iterator itr = m_attributes.begin(); itr != m_attributes.end(); ++itr)
+			{
+				if (itr->first.getLength() == attribName.getLength() &&
+					memcmp(itr->first.getData(), attribName.getData(), attribName.getLength()) == 0)
+					error("Duplicate attribute name: " + attribName.toString(), attribIndex);
+			}
+			
+			// Add this attribute to the list
+			m_attributes.push_back(std::make_pair(attribName, attribValue));
+		}
+	}
+	
+	/***************************************************************
+	* Function: StreamParser::error()
+	* Purpose : Throw a parse error at an input offset
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void StreamParser::error(const std::string& errorText, size_t offset) const
+	{
+		// Compute the text position only now that an error occurred
+		throw ParseError(errorText, getTextPos(offset));
+	}
+	
 	/***************************************************************
 	* Function: escapeString()
 	* Purpose : Escape an XML text string for output
@@ -1528,4 +1960,375 @@ namespace XML
 		// Return the escaped string
 		return escapedStr;
 	}
+
+	/***************************************************************
+	* Function: writeVarInt()
+	* Purpose : Append a variable-length integer to a binary stream
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static void writeVarInt(std::string& output, size_t value)
+	{
+		// Emit 7 bits at a time, setting the high bit while more bytes follow
+		while (value >= 0x80)
+		{
+			output += char((value & 0x7F) | 0x80);
+			value >>= 7;
+		}
+		
+		// Emit the last byte
+		output += char(value);
+	}
+	
+	/***************************************************************
+	* Function: readVarInt()
+	* Purpose : Read a variable-length integer from a binary stream
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static size_t readVarInt(const std::string& input, size_t& charIndex)
+	{
+		// Declare a variable for the decoded value
+		size_t value = 0;
+		
+		// For each 7-bit group
+		for (size_t shift = 0;; shift += 7)
+		{
+			// If we are past the end of the stream or the value overflows
+			if (charIndex >= input.length() || shift >= sizeof(size_t) * 8)
+			{
+				// Throw an exception
+				throw ParseError("Malformed integer in binary XML stream");
+			}
+			
+			// Read the current byte
+			unsigned char thisByte = input[charIndex++];
+			
+			// Add its bits to the value
+			value |= size_t(thisByte & 0x7F) << shift;
+			
+			// If this is the last byte, stop
+			if ((thisByte & 0x80) == 0)
+				break;
+		}
+		
+		// Return the decoded value
+		return value;
+	}
+	
+	/***************************************************************
+	* Function: internString()
+	* Purpose : Get the string table index of a string
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static size_t internString(const std::string& string, StringTable& table, std::vector<std::string>& strings)
+	{
+		// Attempt to find the string in the table
+		StringTable::iterator itr = table.find(string);
+		
+		// If the string is already in the table, return its index
+		if (itr != table.end())
+			return itr->second;
+		
+		// Add the string at the end of the table
+		size_t index = strings.size();
+		strings.push_back(string);
+		table[string] = index;
+		
+		// Return the new index
+		return index;
+	}
+	
+	/***************************************************************
+	* Function: encodeNode()
+	* Purpose : Recursively encode an XML node in binary form
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static void encodeNode(const Node* pNode, std::string& output, StringTable& table, std::vector<std::string>& strings)
+	{
+		// Switch on the node type
+		switch (pNode->getType())
+		{
+			// XML element
+			case Node::ELEMENT:
+			{
+				// Get a typed pointer to the element
+				const Element* pElement = (const Element*)pNode;
+				
+				// Write the node kind, name and text position
+				output += char(BIN_ELEMENT);
+				writeVarInt(output, internString(pElement->getName(), table, strings));
+				writeVarInt(output, pElement->getTextPos().getLine());
+				writeVarInt(output, pElement->getTextPos().getColumn());
+				output += char(pElement->isLeaf()? 1:0);
+				
+				// Write the attribute name and value pairs
+				const std::map<std::string, std::string>& attributes = pElement->getAttributes();
+				writeVarInt(output, attributes.size());
+				for (std::map<std::string, std::string>::const_iterator itr = attributes.begin(); itr != attributes.end(); ++itr)
+				{
+					writeVarInt(output, internString(itr->first, table, strings));
+					writeVarInt(output, internString(itr->second, table, strings));
+				}
+				
+				// Write the children nodes recursively
+				const std::vector<Node*>& children = pElement->getChildren();
+				writeVarInt(output, children.size());
+				for (std::vector<Node*>::const_iterator itr = children.begin(); itr != children.end(); ++itr)
+					encodeNode(*itr, output, table, strings);
+			}
+			break;
+			
+			// Text region
+			case Node::TEXT:
+			{
+				// Write the node kind and text contents
+				output += char(BIN_TEXT);
+				writeVarInt(output, internString(((const Text*)pNode)->getText(), table, strings));
+			}
+			break;
+			
+			// CDATA region
+			case Node::RAWDATA:
+			{
+				// Write the node kind and raw contents
+				output += char(BIN_RAWDATA);
+				writeVarInt(output, internString(((const RawData*)pNode)->getContents(), table, strings));
+			}
+			break;
+			
+			// Other node types
+			default:
+			{
+				// Throw an exception
+				throw ParseError("Unsupported node type in binary XML encoding");
+			}
+		}
+	}
+	
+	/***************************************************************
+	* Function: readTableString()
+	* Purpose : Read a string table reference from a binary stream
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static const std::string& readTableString(const std::string& input, size_t& charIndex, const std::vector<std::string>& strings)
+	{
+		// Read the string index
+		size_t index = readVarInt(input, charIndex);
+		
+		// If the index is not valid, throw an exception
+		if (index >= strings.size())
+			throw ParseError("Invalid string reference in binary XML stream");
+		
+		// Return the string
+		return strings[index];
+	}
+	
+	/***************************************************************
+	* Function: decodeNode()
+	* Purpose : Recursively decode an XML node from binary form
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	static Node* decodeNode(const std::string& input, size_t& charIndex, const std::vector<std::string>& strings)
+	{
+		// If we are past the end of the stream, throw an exception
+		if (charIndex >= input.length())
+			throw ParseError("Unexpected end of binary XML stream");
+		
+		// Read the node kind
+		unsigned char nodeKind = input[charIndex++];
+		
+		// Switch on the node kind
+		switch (nodeKind)
+		{
+			// XML element
+			case BIN_ELEMENT:
+			{
+				// Read the name and text position
+				const std::string& name = readTableString(input, charIndex, strings);
+				size_t line = readVarInt(input, charIndex);
+				size_t column = readVarInt(input, charIndex);
+				
+				// Read the leaf flag
+				if (charIndex >= input.length())
+					throw ParseError("Unexpected end of binary XML stream");
+				bool isLeaf = (input[charIndex++] != 0);
+				
+				// Read the attribute name and value pairs
+				std::map<std::string, std::string> attributes;
+				size_t numAttribs = readVarInt(input, charIndex);
+				for (size_t i = 0; i < numAttribs; ++i)
+				{
+					const std::string& attribName = readTableString(input, charIndex, strings);
+					attributes[attribName] = readTableString(input, charIndex, strings);
+				}
+				
+				// Read the number of children, which cannot exceed the remaining input
+				size_t numChildren = readVarInt(input, charIndex);
+				if (numChildren > input.length() - charIndex)
+					throw ParseError("Invalid child count in binary XML stream");
+				
+				// Declare a vector for the children nodes
+				std::vector<Node*> children;
+				children.reserve(numChildren);
+				
+				// Setup a try block to free partially decoded children
+				try
+				{
+					// Decode each child node recursively
+					for (size_t i = 0; i < numChildren; ++i)
+						children.push_back(decodeNode(input, charIndex, strings));
+				}
+				catch (ParseError error)
+				{
+					for (std::vector<Node*>::iterator itr = children.begin(); itr != children.end(); ++itr)
+						delete *itr;
+					throw error;
+				}
+				
+				// Create and return the new element
+				return new Element(name, attributes, children, TextPos(line, column), isLeaf);
+			}
+			
+			// Text region
+			case BIN_TEXT:
+			{
+				// Create and return a new text node
+				return new Text(readTableString(input, charIndex, strings));
+			}
+			
+			// CDATA region
+			case BIN_RAWDATA:
+			{
+				// Create and return a new raw data node
+				return new RawData(readTableString(input, charIndex, strings));
+			}
+			
+			// Unknown node kinds
+			default:
+			{
+				// Throw an exception
+				throw ParseError("Invalid node kind in binary XML stream");
+			}
+		}
+	}
+	
+	/***************************************************************
+	* Function: encodeBinary()
+	* Purpose : Encode an XML tree into the compact binary format
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	std::string encodeBinary(const Element* pTree)
+	{
+		// Ensure that the tree is valid
+		assert (pTree != NULL);
+		
+		// Declare a string table and a buffer for the node stream
+		StringTable table;
+		std::vector<std::string> strings;
+		std::string nodeStream;
+		
+		// Encode the tree, filling the string table as we go
+		encodeNode(pTree, nodeStream, table, strings);
+		
+		// Write the signature and version number
+		std::string output(BINARY_SIGNATURE, BINARY_SIGNATURE_LENGTH);
+		output += char(BINARY_VERSION);
+		
+		// Write the string table, with each string prefixed by its length
+		writeVarInt(output, strings.size());
+		for (std::vector<std::string>::const_iterator itr = strings.begin(); itr != strings.end(); ++itr)
+		{
+			writeVarInt(output, itr->length());
+			output += *itr;
+		}
+		
+		// Append the node stream
+		output += nodeStream;
+		
+		// Return the encoded tree
+		return output;
+	}
+	
+	/***************************************************************
+	* Function: decodeBinary()
+	* Purpose : Decode an XML tree from the compact binary format
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	Element* decodeBinary(const std::string& input)
+	{
+		// If the signature or version do not match, throw an exception
+		if (!isBinaryEncoded(input))
+			throw ParseError("Invalid binary XML stream signature");
+		if ((unsigned char)input[BINARY_SIGNATURE_LENGTH] != BINARY_VERSION)
+			throw ParseError("Unsupported binary XML stream version");
+		
+		// Start reading after the header
+		size_t charIndex = BINARY_SIGNATURE_LENGTH + 1;
+		
+		// Read the number of strings, which cannot exceed the remaining input
+		size_t numStrings = readVarInt(input, charIndex);
+		if (numStrings > input.length() - charIndex)
+			throw ParseError("Invalid string count in binary XML stream");
+		
+		// Read the string table
+		std::vector<std::string> strings;
+		strings.reserve(numStrings);
+		for (size_t i = 0; i < numStrings; ++i)
+		{
+			// Read the string length
+			size_t length = readVarInt(input, charIndex);
+			
+			// If the string extends past the end of the stream, throw an exception
+			if (length > input.length() - charIndex)
+				throw ParseError("Unexpected end of binary XML stream");
+			
+			// Extract the string
+			strings.push_back(input.substr(charIndex, length));
+			charIndex += length;
+		}
+		
+		// Decode the tree root
+		Node* pRoot = decodeNode(input, charIndex, strings);
+		
+		// If the root is not an element, throw an exception
+		if (pRoot->getType() != Node::ELEMENT)
+		{
+			delete pRoot;
+			throw ParseError("Binary XML stream root is not an element");
+		}
+		
+		// Return the decoded tree
+		return (Element*)pRoot;
+	}
+	
+	/***************************************************************
+	* Function: isBinaryEncoded()
+	* Purpose : Test if a string holds a binary-encoded XML tree
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	bool isBinaryEncoded(const std::string& input)
+	{
+		// Test for the signature and the version byte
+		return (
+			input.length() > BINARY_SIGNATURE_LENGTH &&
+			input.compare(0, BINARY_SIGNATURE_LENGTH, BINARY_SIGNATURE, BINARY_SIGNATURE_LENGTH) == 0
+		);
+	}
 }
@@ -362,6 +362,136 @@ namespace XML
 		Element* m_pTree;
 	};
 	
+	/***************************************************************
+	* Class   : StrRef
+	* Purpose : Reference a substring of an XML input buffer
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	class StrRef
+	{
+	public:
+		
+		// Constructors
+		StrRef(const char* pData, size_t length, bool escaped = false)
+		: m_pData(pData), m_length(length), m_escaped(escaped) {}
+		StrRef() : m_pData(NULL), m_length(0), m_escaped(false) {}
+		
+		// Method to obtain the string, with escape sequences decoded
+		std::string toString() const;
+		
+		// Method to compare the raw referenced characters with a string
+		bool equals(const char* pString) const;
+		
+		// Accessor to get a pointer to the raw characters
+		const char* getData() const { return m_pData; }
+		
+		// Accessor to get the number of raw characters
+		size_t getLength() const { return m_length; }
+		
+		// Accessor to tell if the string contains escape sequences
+		bool isEscaped() const { return m_escaped; }
+		
+	private:
+		
+		// Pointer to the first character
+		const char* m_pData;
+		
+		// Number of characters referenced
+		size_t m_length;
+		
+		// Flag indicating the presence of escape sequences
+		bool m_escaped;
+	};
+	
+	// Attribute reference list definition
+	typedef std::vector<std::pair<StrRef, StrRef> > AttribRefList;
+	
+	/***************************************************************
+	* Class   : StreamHandler
+	* Purpose : Receive events from the streaming XML parser
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	class StreamHandler
+	{
+	public:
+		
+		// Destructor
+		virtual ~StreamHandler() {}
+		
+		// Method called when an element is opened
+		virtual void startElement(const StrRef& name, const AttribRefList& attributes, size_t offset) = 0;
+		
+		// Method called when an element is closed
+		virtual void endElement(const StrRef& name) = 0;
+		
+		// Method called for a text region, trimmed of surrounding whitespace
+		virtual void text(const StrRef& text) = 0;
+		
+		// Method called for a CDATA region
+		virtual void rawData(const StrRef& contents) = 0;
+	};
+	
+	/***************************************************************
+	* Class   : StreamParser
+	* Purpose : Event-driven XML parser working in place on a buffer
+	* Initial : McVM team on October 16, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	class StreamParser
+	{
+	public:
+		
+		// Constructor
+		StreamParser(const char* pInput, size_t length)
+		: m_pInput(pInput), m_length(length), m_charIndex(0) {}
+		
+		// Method to parse the input, reporting events to a handler
+		void parse(StreamHandler& handler);
+		
+		// Method to compute the text position of an input offset
+		TextPos getTextPos(size_t offset) const;
+		
+	private:
+		
+		// Method to test if a token appears at the current index
+		bool match(const char* pToken) const;
+		
+		// Method to skip whitespace characters
+		void skipSpace();
+		
+		// Method to find a token from the current index
+		size_t findToken(const char* pToken, const char* pErrorText);
+		
+		// Method to parse an XML tag name
+		StrRef parseName(const char* pErrorText);
+		
+		// Method to parse the attributes of an opening tag
+		bool parseAttributes();
+		
+		// Method to throw a parse error at an input offset
+		void error(const std::string& errorText, size_t offset) const;
+		
+		// Input buffer
+		const char* m_pInput;
+		
+		// Input buffer length
+		size_t m_length;
+		
+		// Current character index
+		size_t m_charIndex;
+		
+		// Attributes of the current opening tag
+		AttribRefList m_attributes;
+		
+		// Stack of currently open element names
+		std::vector<StrRef> m_openTags;
+	};
+	
 	/***************************************************************
 	* Class   : Parser
 	* Purpose : Parse XML data into tree form
@@ -379,6 +509,9 @@ namespace XML
 		// Parse an XML file
 		Document parseFile(const std::string& filePath);
 
+		// Method to parse an XML input string in streaming mode
+		void parseStream(const std::string& xmlString, StreamHandler& handler);
+
 		// Save an XML file
 		void saveFile(const std::string& filePath, const Node* pXMLTree);
 		
@@ -414,6 +547,15 @@ namespace XML
 	
 	// Function to escape an XML string for output
 	std::string escapeString(const std::string& input);
+	
+	// Function to encode an XML tree into the compact binary format
+	std::string encodeBinary(const Element* pTree);
+	
+	// Function to decode an XML tree from the compact binary format
+	Element* decodeBinary(const std::string& input);
+	
+	// Function to test if a string holds a binary-encoded XML tree
+	bool isBinaryEncoded(const std::string& input);
 }
 
 #endif // #ifndef XML_H_
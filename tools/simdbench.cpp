@@ -0,0 +1,207 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cstdio>
+#include <iostream>
+#include <sys/time.h>
+#include "../source/matrixobjs.h"
+#include "../source/matrixops.h"
+#include "../source/simdkernels.h"
+
+// Number of operations per measurement
+static const size_t NUM_ITERATIONS = 200;
+
+/***************************************************************
+* Function: getTime()
+* Purpose : Get the current time in seconds
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static double getTime()
+{
+	// Get the time of day
+	struct timeval timeVal;
+	gettimeofday(&timeVal, NULL);
+	
+	// Convert it to seconds
+	return timeVal.tv_sec + timeVal.tv_usec * 1e-6;
+}
+
+/***************************************************************
+* Function: makeMatrix()
+* Purpose : Create a row vector of test values
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class T> static MatrixObj<T>* makeMatrix(size_t numElems, double offset)
+{
+	// Create the matrix
+	MatrixObj<T>* pMatrix = new MatrixObj<T>(1, numElems);
+	
+	// Fill it with non-zero values
+	T* pElems = pMatrix->getElements();
+	for (size_t i = 0; i < numElems; ++i)
+		pElems[i] = (T)(1.0 + offset + (i % 7) * 0.25);
+	
+	// Return the matrix
+	return pMatrix;
+}
+
+/***************************************************************
+* Function: benchBinary()
+* Purpose : Measure the bandwidth of a binary array operation
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class Op, class T> static double benchBinary(size_t numElems, bool scalarRhs)
+{
+	// Create the operands
+	MatrixObj<T>* pA = makeMatrix<T>(numElems, 0);
+	MatrixObj<T>* pB = makeMatrix<T>(scalarRhs? 1:numElems, 1);
+	
+	// Perform the operations
+	double startTime = getTime();
+	for (size_t i = 0; i < NUM_ITERATIONS; ++i)
+		MatrixObj<T>::template binArrayOp<Op, T>(pA, pB);
+	double elapsed = getTime() - startTime;
+	
+	// Compute the bandwidth from the bytes read and written
+	double numBytes = (scalarRhs? 2.0:3.0) * numElems * sizeof(T) * NUM_ITERATIONS;
+	return numBytes / elapsed / 1e9;
+}
+
+/***************************************************************
+* Function: benchUnary()
+* Purpose : Measure the bandwidth of a unary array operation
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class Op, class T> static double benchUnary(size_t numElems)
+{
+	// Create the operand
+	MatrixObj<T>* pA = makeMatrix<T>(numElems, 0);
+	
+	// Perform the operations
+	double startTime = getTime();
+	for (size_t i = 0; i < NUM_ITERATIONS; ++i)
+		MatrixObj<T>::template arrayOp<Op, T>(pA);
+	double elapsed = getTime() - startTime;
+	
+	// Compute the bandwidth from the bytes read and written
+	double numBytes = 2.0 * numElems * sizeof(T) * NUM_ITERATIONS;
+	return numBytes / elapsed / 1e9;
+}
+
+/***************************************************************
+* Function: runBenchmarks()
+* Purpose : Measure every operation at every kernel level
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void runBenchmarks(size_t numElems, int maxLevel)
+{
+	// Print the table header
+	printf("\n%lu elements, GB/s\n", (unsigned long)numElems);
+	printf("%-22s", "op / type");
+	for (int level = 0; level <= maxLevel; ++level)
+		printf("%10s", SimdKernels::getLevelName((SimdKernels::Level)level));
+	printf("\n");
+	
+	// Operation names
+	const char* OP_NAMES[] = {
+		"add / float64", "sub / float64", "mult / float64", "div / float64",
+		"mult scalar / float64", "sqrt / float64", "abs / float64",
+		"add / float32", "mult / float32", "div / float32",
+		"add / complex128", "sub / complex128",
+		"and / bool", "or / bool"
+	};
+	const size_t NUM_OPS = sizeof(OP_NAMES) / sizeof(OP_NAMES[0]);
+	
+	// For each operation
+	for (size_t op = 0; op < NUM_OPS; ++op)
+	{
+		// Print the operation name
+		printf("%-22s", OP_NAMES[op]);
+		
+		// For each kernel level
+		for (int level = 0; level <= maxLevel; ++level)
+		{
+			// Select the kernel level
+			char levelStr[8];
+			sprintf(levelStr, "%d", level);
+			SimdKernels::s_simdMaxLevelVar.setValue(levelStr);
+			
+			// Measure the operation
+			double gbps = 0;
+			switch (op)
+			{
+				case 0: gbps = benchBinary<AddOp<float64>, float64>(numElems, false); break;
+				case 1: gbps = benchBinary<SubOp<float64>, float64>(numElems, false); break;
+				case 2: gbps = benchBinary<MultOp<float64>, float64>(numElems, false); break;
+				case 3: gbps = benchBinary<DivOp<float64>, float64>(numElems, false); break;
+				case 4: gbps = benchBinary<MultOp<float64>, float64>(numElems, true); break;
+				case 5: gbps = benchUnary<SqrtOp<float64>, float64>(numElems); break;
+				case 6: gbps = benchUnary<AbsOp<float64, float64>, float64>(numElems); break;
+				case 7: gbps = benchBinary<AddOp<float32>, float32>(numElems, false); break;
+				case 8: gbps = benchBinary<MultOp<float32>, float32>(numElems, false); break;
+				case 9: gbps = benchBinary<DivOp<float32>, float32>(numElems, false); break;
+				case 10: gbps = benchBinary<AddOp<Complex128>, Complex128>(numElems, false); break;
+				case 11: gbps = benchBinary<SubOp<Complex128>, Complex128>(numElems, false); break;
+				case 12: gbps = benchBinary<AndOp<bool>, bool>(numElems, false); break;
+				case 13: gbps = benchBinary<OrOp<bool>, bool>(numElems, false); break;
+			}
+			
+			// Print the bandwidth
+			printf("%10.2f", gbps);
+		}
+		printf("\n");
+	}
+}
+
+/***************************************************************
+* Function: main()
+* Purpose : Program entry point
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+int main(int argc, char** argv)
+{
+	// Detect the CPU features
+	SimdKernels::initialize();
+	
+	// Get the highest level supported by this CPU
+	int maxLevel = SimdKernels::getLevel();
+	
+	// Print the benchmark information
+	std::cout << "Array kernel benchmark (" << NUM_ITERATIONS << " iterations each)" << std::endl;
+	std::cout << "CPU kernel level: " << SimdKernels::getLevelName((SimdKernels::Level)maxLevel) << std::endl;
+	
+	// Measure cache-resident and memory-bound sizes
+	runBenchmarks(4096, maxLevel);
+	runBenchmarks(1 << 20, maxLevel);
+	
+	// Nothing went wrong
+	return 0;
+}
@@ -0,0 +1,366 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 McGill University.                                           //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../source/xml.h"
+
+// Number of parse iterations per measurement
+static const size_t NUM_ITERATIONS = 5;
+
+// Parsing modes measured
+enum ParseMode
+{
+	DOM_MODE,
+	STREAM_MODE,
+	BINARY_MODE
+};
+
+// Names of the parsing modes
+static const char* MODE_NAMES[] = { "dom", "stream", "binary" };
+
+/***************************************************************
+* Class   : CountingHandler
+* Purpose : Stream handler touching every reported event
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class CountingHandler : public XML::StreamHandler
+{
+public:
+	
+	// Constructor
+	CountingHandler() : numElements(0), numBytes(0) {}
+	
+	// Method called when an element is opened
+	void startElement(const XML::StrRef& name, const XML::AttribRefList& attributes, size_t offset)
+	{
+		// Count the element and the size of its attributes
+		++numElements;
+		numBytes += name.getLength();
+		for (XML::AttribRefList::const_iterator itr = attributes.begin(); itr != attributes.end(); ++itr)
+			numBytes += itr->first.getLength() + itr->second.getLength();
+	}
+	
+	// Method called when an element is closed
+	void endElement(const XML::StrRef& name) {}
+	
+	// Method called for a text region
+	void text(const XML::StrRef& text) { numBytes += text.getLength(); }
+	
+	// Method called for a CDATA region
+	void rawData(const XML::StrRef& contents) { numBytes += contents.getLength(); }
+	
+	// Number of elements seen
+	size_t numElements;
+	
+	// Number of name, attribute and text bytes seen
+	size_t numBytes;
+};
+
+/***************************************************************
+* Function: getTime()
+* Purpose : Get the current time in seconds
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static double getTime()
+{
+	// Get the time of day
+	struct timeval timeVal;
+	gettimeofday(&timeVal, NULL);
+	
+	// Convert it to seconds
+	return timeVal.tv_sec + timeVal.tv_usec * 1e-6;
+}
+
+/***************************************************************
+* Function: getPeakMemory()
+* Purpose : Get the peak resident set size in kilobytes
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static long getPeakMemory()
+{
+	// Get the resource usage of this process
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	
+	// Return the maximum resident set size
+	return usage.ru_maxrss;
+}
+
+/***************************************************************
+* Function: makeSyntheticAST()
+* Purpose : Generate a synthetic XML IR of a given size
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static std::string makeSyntheticAST(size_t numBytes)
+{
+	// Begin the compilation unit and the script body
+	std::string output = "<CompilationUnits id=\"0\">\n    <Script id=\"1\">\n        <StmtList>\n";
+	
+	// Add assignment statements until the requested size is reached
+	for (size_t id = 2; output.length() < numBytes; id += 6)
+	{
+		char stmt[512];
+		sprintf(stmt,
+			"            <AssignStmt id=\"%lu\">\n"
+			"                <NameExpr id=\"%lu\">\n"
+			"                    <Name id=\"%lu\" nameId=\"a\"/>\n"
+			"                </NameExpr>\n"
+			"                <PlusExpr id=\"%lu\">\n"
+			"                    <IntLiteralExpr id=\"%lu\" value=\"%lu\"/>\n"
+			"                    <StringLiteralExpr id=\"%lu\" value=\"x &amp; y\"/>\n"
+			"                </PlusExpr>\n"
+			"            </AssignStmt>\n",
+			(unsigned long)id, (unsigned long)id+1, (unsigned long)id+2,
+			(unsigned long)id+3, (unsigned long)id+4, (unsigned long)id, (unsigned long)id+5
+		);
+		output += stmt;
+	}
+	
+	// Close the script and the compilation unit
+	output += "        </StmtList>\n    </Script>\n</CompilationUnits>\n";
+	
+	// Return the generated IR
+	return output;
+}
+
+/***************************************************************
+* Function: runMode()
+* Purpose : Measure one parsing mode in a child process,
+*           the binary mode decodes the parse cache format and
+*           checks that it yields the tree parsed from text
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void runMode(const std::string& label, const std::string& input, ParseMode mode)
+{
+	// Flush the output before forking
+	std::cout.flush();
+	
+	// Run the measurement in a child, so each mode has its own peak memory
+	pid_t pid = fork();
+	if (pid != 0)
+	{
+		// Wait for the child to complete
+		waitpid(pid, NULL, 0);
+		return;
+	}
+	
+	// Binary IR encoding of the input, and its tree as text
+	std::string encoded;
+	std::string treeText;
+	
+	// Setup a try block to catch parsing errors
+	try
+	{
+		// If binary mode is requested, encode the input before measuring
+		if (mode == BINARY_MODE)
+		{
+			XML::Document document = XML::Parser().parseString(input);
+			encoded = XML::encodeBinary(document.getTree());
+			treeText = document.getTree()->toString();
+		}
+	}
+	
+	// If a parsing error occurs
+	catch (XML::ParseError error)
+	{
+		// Report the error
+		printf("%-36s %-6s parse error %s\n", label.c_str(), MODE_NAMES[mode], error.toString().c_str());
+		fflush(stdout);
+		_exit(1);
+	}
+	
+	// Get the peak memory before parsing
+	long startMemory = getPeakMemory();
+	
+	// Variable to store the element count of the last iteration
+	size_t numElements = 0;
+	
+	// Start timing
+	double startTime = getTime();
+	
+	// Setup a try block to catch parsing errors
+	try
+	{
+		// For each iteration
+		for (size_t i = 0; i < NUM_ITERATIONS; ++i)
+		{
+			// If binary mode is requested
+			if (mode == BINARY_MODE)
+			{
+				// Decode the binary tree, as the parse cache does for its entries
+				XML::Element* pTree = XML::decodeBinary(encoded);
+				numElements = pTree? 1:0;
+				
+				// On the last iteration, check the decoded tree against the text parse
+				if (i == NUM_ITERATIONS - 1 && (pTree == NULL || pTree->toString() != treeText))
+				{
+					printf("%-36s %-6s decoded tree differs from the text parse\n", label.c_str(), MODE_NAMES[mode]);
+					fflush(stdout);
+					_exit(1);
+				}
+				delete pTree;
+			}
+			
+			// If streaming mode is requested
+			else if (mode == STREAM_MODE)
+			{
+				// Parse the input, counting the elements
+				CountingHandler handler;
+				XML::Parser().parseStream(input, handler);
+				numElements = handler.numElements;
+			}
+			else
+			{
+				// Build the whole document tree
+				XML::Document document = XML::Parser().parseString(input);
+				numElements = document.getTree()? 1:0;
+			}
+		}
+	}
+	
+	// If a parsing error occurs
+	catch (XML::ParseError error)
+	{
+		// Report the error
+		printf("%-36s %-6s parse error %s\n", label.c_str(), MODE_NAMES[mode], error.toString().c_str());
+		fflush(stdout);
+		_exit(1);
+	}
+	
+	// Compute the average parse time
+	double parseTime = (getTime() - startTime) / NUM_ITERATIONS;
+	
+	// Report the measurements
+	// NOTE: the peak memory of the binary mode includes the text parse
+	// used to encode the input, so only its time and size are reported
+	if (mode == BINARY_MODE)
+	{
+		printf("%-36s %-6s %10.2f ms, %lu bytes encoded\n",
+			label.c_str(), MODE_NAMES[mode], parseTime * 1000,
+			(unsigned long)encoded.length()
+		);
+	}
+	else
+	{
+		printf("%-36s %-6s %10.2f ms %10ld KB peak (+%ld KB)",
+			label.c_str(), MODE_NAMES[mode], parseTime * 1000,
+			getPeakMemory(), getPeakMemory() - startMemory
+		);
+		if (mode == STREAM_MODE)
+			printf(", %lu elements", (unsigned long)numElements);
+		printf("\n");
+	}
+	fflush(stdout);
+	
+	// Exit the child process
+	_exit(0);
+}
+
+/***************************************************************
+* Function: readFile()
+* Purpose : Read an entire file into a string
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool readFile(const char* pFileName, std::string& output)
+{
+	// Attempt to open the file
+	FILE* pFile = fopen(pFileName, "rb");
+	if (!pFile)
+		return false;
+	
+	// Read the file contents
+	char buffer[4096];
+	size_t numRead;
+	while ((numRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+		output.append(buffer, numRead);
+	
+	// Close the file
+	fclose(pFile);
+	return true;
+}
+
+/***************************************************************
+* Function: main()
+* Purpose : Compare DOM, streaming and binary IR parse time and memory
+* Initial : McVM team on October 16, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+int main(int argc, char** argv)
+{
+	// Print usage information
+	std::cout << "XML parser benchmark: DOM vs. streaming vs. binary IR (" << NUM_ITERATIONS << " iterations each)" << std::endl;
+	std::cout << "usage: " << argv[0] << " [file.xml ...]" << std::endl << std::endl;
+	
+	// For each input file given
+	for (int i = 1; i < argc; ++i)
+	{
+		// Read the file contents
+		std::string input;
+		if (!readFile(argv[i], input))
+		{
+			std::cout << "could not read \"" << argv[i] << "\"" << std::endl;
+			continue;
+		}
+		
+		// Measure all parsing modes
+		runMode(argv[i], input, DOM_MODE);
+		runMode(argv[i], input, STREAM_MODE);
+		runMode(argv[i], input, BINARY_MODE);
+	}
+	
+	// For each synthetic input size, in megabytes
+	const size_t SYNTH_SIZES[] = { 1, 4, 16 };
+	for (size_t i = 0; i < sizeof(SYNTH_SIZES) / sizeof(SYNTH_SIZES[0]); ++i)
+	{
+		// Generate the synthetic IR
+		std::string input = makeSyntheticAST(SYNTH_SIZES[i] << 20);
+		char label[64];
+		sprintf(label, "synthetic %lu MB", (unsigned long)SYNTH_SIZES[i]);
+		
+		// Measure all parsing modes
+		runMode(label, input, DOM_MODE);
+		runMode(label, input, STREAM_MODE);
+		runMode(label, input, BINARY_MODE);
+	}
+	
+	// Nothing went wrong
+	return 0;
+}